@@ -1,44 +1,163 @@
 #ifndef ARRAY_LINKED_LIST_H_
 #define ARRAY_LINKED_LIST_H_
 
+#include <atomic>
+#include <functional>
 #include <iostream>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <new>
+
+#include "listFile.h"
+#include "listStats.h"
+#include "listWriter.h"
 
 const int DEFAULT_SIZE = 1024;
 const int NULL_VALUE = -1; // a nonexistent location
 
-template <typename T> class List;
-template <typename T> std::ostream& operator<<(std::ostream&, const List<T>&);
+// nodes are stored in segments of at least this many nodes
+const int MIN_SEGMENT_SIZE = 16;
+
+// fraction of out-of-order links above which automatic compaction kicks in
+const double DEFAULT_COMPACT_THRESHOLD = 0.5;
+
+// the fragmentation of a list is checked after every max(size, this many)
+// changes, which keeps the cost of checking amortized O(1) per change
+const int MIN_COMPACT_CHECK_INTERVAL = 64;
+
+/*
+ * Layouts of the nodes within a segment. A layout gives the type of a
+ * segment, how to allocate and free one and how many bytes it takes, and how
+ * to reach the element and the next index of the node at an offset in it.
+ * 
+ * InterleavedNodes, the default, keeps each element beside its next index.
+ * ParallelArrays keeps the next indices of a segment in one array and the
+ * elements in another, so walking the list reads a dense run of ints and
+ * touches an element only when it is used. It pays off for large elements
+ * and for the walks to a position done by insert, remove and the ranges.
+ */
 
 template <class T>
-class List {
+class InterleavedNodes {
    private:
       class Node {
-         public: 
-            Node() { next = NULL_VALUE; };
-            Node(const int& nextIndex) { next = nextIndex; };
+         public:
             T data;
             int next;
       };
    public:
-      List(const int&);
+      typedef Node * Segment;
+      
+      static Segment allocate(const int& length) {
+         Segment segment = new(std::nothrow) Node[length];
+         assert(segment != 0);
+         return segment;
+      }
+      static void deallocate(const Segment& segment) {
+         delete [] segment;
+      }
+      static std::size_t size(const int& length) {
+         return length*sizeof(Node);
+      }
+      static T& item(const Segment& segment, const int& offset) {
+         return segment[offset].data;
+      }
+      static int& next(const Segment& segment, const int& offset) {
+         return segment[offset].next;
+      }
+};
+
+template <class T>
+class ParallelArrays {
+   public:
+      class Segment {
+         public:
+            int * next;
+            T * items;
+      };
+      
+      static Segment allocate(const int& length) {
+         Segment segment;
+         segment.next = new(std::nothrow) int[length];
+         segment.items = new(std::nothrow) T[length];
+         assert(segment.next!=0 && segment.items!=0);
+         return segment;
+      }
+      static void deallocate(const Segment& segment) {
+         delete [] segment.next;
+         delete [] segment.items;
+      }
+      static std::size_t size(const int& length) {
+         return length*(sizeof(int)+sizeof(T));
+      }
+      static T& item(const Segment& segment, const int& offset) {
+         return segment.items[offset];
+      }
+      static int& next(const Segment& segment, const int& offset) {
+         return segment.next[offset];
+      }
+};
+
+template <typename T, template <class> class Layout = InterleavedNodes,
+          class Stats = LIST_STATS> class List;
+template <typename T, template <class> class Layout, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Layout, Stats>&);
+
+template <class T, template <class> class Layout, class Stats>
+class List : private Stats {
+   private:
+      typedef typename Layout<T>::Segment Segment;
+   public:
+      List(const int& capacity=DEFAULT_SIZE);
       List(const List&);
       
       ~List();
      
       int getSize() const;
       int getCapacity() const;
+      const Stats& getStats() const;
       
       bool isEmpty() const;
+      bool isShared() const;
       bool insert(const T&, const int&);
       bool remove(const int&);
       
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      void sort();
+      template <class Compare>
+      void sort(Compare);
+      
+      double getFragmentation() const;
+      bool compact();
+      void setAutoCompact(const bool&,
+                          const double& threshold=DEFAULT_COMPACT_THRESHOLD);
+      void setCopyOnWrite(const bool&);
+      
       const List& operator=(const List&);
       
-      void display(std::ostream&) const;
-      friend std::ostream& operator<< <>(std::ostream&, const List<T>&);
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = false;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      bool write(std::ostream&) const;
+      bool read(std::istream&);
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
    private:
-      Node * _items; // array to store list elements
+      // the nodes are stored in equally sized segments, each a power of two
+      // long, so node i is at offset i & mask of _segments[i >> _segmentShift],
+      // laid out within it by Layout. Growing the list adds segments; existing
+      // nodes never move.
+      Segment * _segments;
+      int _segmentCount; // the number of segments allocated
+      int _segmentSlots; // the number of pointers _segments has room for
+      int _segmentShift; // each segment holds 1 << _segmentShift nodes
+      
       int _size; // the number of elements stored in the linked list
       int _capacity; // current amount of allocated memory
       
@@ -50,9 +169,34 @@ class List {
       // array that has been allocated.
       int _firstNewNodeIndex;
       
+      // _inOrder is true while the element at position i is stored at index
+      // i for every position, so positions can be found without a walk
+      bool _inOrder;
+      
+      bool _autoCompact;
+      double _compactThreshold;
+      int _changesSinceCheck; // inserts and removes since the last check
+      
+      // with copy-on-write on, the number of lists sharing the segments
+      // (and the segment table); 0 when it is off. Copies share them until
+      // one of them changes, and shared segments are never changed.
+      std::atomic<int> * _references;
+      
+      T & itemAt(const int&) const;
+      int & nextAt(const int&) const;
+      
       int getNewNodeIndex();
+      int findNodeIndex(const int&) const;
+      int splitRun(int, const int&);
+      template <class Compare>
+      int * mergeRuns(int, int, int *, Compare&);
+      bool grow(const int&);
+      void checkFragmentation(const int&);
       
-      bool createCopyOfList(Node *, Node * &, const int&);
+      bool createCopyOfList(Segment *, Segment * &, const int&);
+      void deleteSegments();
+      bool unshare();
+      void releaseSegments();
 };
 
 /*****************************************************************************/
@@ -64,28 +208,38 @@ class List {
  * 
  * Precondition: capacity is a positive integer with default value of 
  *    DEFAULT_SIZE
- * Postcondition: An empty list, with size 0. The list is now a dynamically
- *    allocated array with capacity as its capacity.
+ * Postcondition: An empty list, with size 0. The list has one dynamically
+ *    allocated segment of nodes, capacity rounded up to a power of two (and
+ *    at least MIN_SEGMENT_SIZE) long. Later growth adds segments of the same
+ *    size.
  * 
- * Worst-Case Time Complexity: O(1)
+ * Worst-Case Time Complexity: O(capacity)
  */
-template <class T>
-List<T>::List(const int& capacity=DEFAULT_SIZE) {
-   _capacity = capacity;
+template <class T, template <class> class Layout, class Stats>
+List<T, Layout, Stats>::List(const int& capacity) {
+   _capacity = 0;
    _size = 0;
    _first = NULL_VALUE;
+   _firstNewNodeIndex = NULL_VALUE;
    
-   _items = new(std::nothrow) Node[_capacity];
-   assert(_items != 0);
+   _inOrder = true;
+   _autoCompact = false;
+   _compactThreshold = DEFAULT_COMPACT_THRESHOLD;
+   _changesSinceCheck = 0;
    
-   _firstNewNodeIndex=0;
-   for (int i=0; i<_capacity; ++i) {
-      if (i+1<_capacity) {
-         _items[i] = Node(i+1);
-      } else {
-         _items[i] = Node(NULL_VALUE);
-      }
+   _segmentShift = 0;
+   while ((1 << _segmentShift) < capacity ||
+          (1 << _segmentShift) < MIN_SEGMENT_SIZE) {
+      ++_segmentShift;
    }
+   
+   _segments = 0;
+   _segmentCount = 0;
+   _segmentSlots = 0;
+   
+   _references = 0;
+   
+   grow(1 << _segmentShift);
 }
 
 /**
@@ -93,18 +247,39 @@ List<T>::List(const int& capacity=DEFAULT_SIZE) {
  * 
  * Precondition: A copy of originalList is needed. originalList is a const
  *    reference parameter
- * Postcondition: A copy of originalList has been constructed.
+ * Postcondition: A copy of originalList has been constructed. If
+ *    originalList is in copy-on-write mode, the copy shares its segments and
+ *    is in copy-on-write mode too.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(capacity); O(1) in copy-on-write mode
  */
-template <class T>
-List<T>::List(const List& originalList) {
+template <class T, template <class> class Layout, class Stats>
+List<T, Layout, Stats>::List(const List& originalList) {
    _size = originalList._size;
    _capacity = originalList._capacity;
    _first = originalList._first;
    _firstNewNodeIndex = originalList._firstNewNodeIndex;
    
-   createCopyOfList(originalList._items, _items, originalList._capacity);
+   _inOrder = originalList._inOrder;
+   _autoCompact = originalList._autoCompact;
+   _compactThreshold = originalList._compactThreshold;
+   _changesSinceCheck = originalList._changesSinceCheck;
+   
+   _segmentShift = originalList._segmentShift;
+   _segmentCount = originalList._segmentCount;
+   _segmentSlots = originalList._segmentCount;
+   
+   _references = originalList._references;
+   if (_references != 0) {
+      _references->fetch_add(1);
+      _segments = originalList._segments;
+      _segmentSlots = originalList._segmentSlots;
+      return;
+   }
+   
+   _segments = 0;
+   createCopyOfList(originalList._segments, _segments,
+                    originalList._segmentCount);
 }
 
 /*****************************************************************************/
@@ -115,14 +290,14 @@ List<T>::List(const List& originalList) {
  * Destroy a list object
  * 
  * Precondition: The life of the object is over.
- * Postcondition: The memory dynamically allocated by the constructor for the
- *    array pointed to by _items has been returned to the heap.
+ * Postcondition: The memory dynamically allocated for the segments of nodes
+ *    has been returned to the heap, unless other lists still share it.
  * 
- * Worst-Case Time Complexity: O(1)
+ * Worst-Case Time Complexity: O(number of segments)
  */
-template <class T>
-List<T>::~List() {
-   delete [] _items;
+template <class T, template <class> class Layout, class Stats>
+List<T, Layout, Stats>::~List() {
+   releaseSegments();
 }
 
 /*****************************************************************************/
@@ -137,8 +312,8 @@ List<T>::~List() {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getSize() const {
+template <class T, template <class> class Layout, class Stats>
+int List<T, Layout, Stats>::getSize() const {
    return _size;
 }
 
@@ -154,11 +329,25 @@ int List<T>::getSize() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getCapacity() const {
+template <class T, template <class> class Layout, class Stats>
+int List<T, Layout, Stats>::getCapacity() const {
    return -1;
 }
 
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Layout, class Stats>
+const Stats& List<T, Layout, Stats>::getStats() const {
+   return *this;
+}
+
 /**
  * Check if a list is empty
  * 
@@ -167,11 +356,25 @@ int List<T>::getCapacity() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-bool List<T>::isEmpty() const {
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::isEmpty() const {
    return _size==0;
 }
 
+/**
+ * Check if the list shares its segments with a copy-on-write copy
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if another list holds the same segments, so the
+ *    next change to either list will copy them, and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::isShared() const {
+   return _references!=0 && _references->load()>1;
+}
+
 /*****************************************************************************/
 /********************** Functions ********************************************/
 /*****************************************************************************/
@@ -185,59 +388,48 @@ bool List<T>::isEmpty() const {
  * 
  * Worst-case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::insert(const T& item, const int& position) {   
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::insert(const T& item, const int& position) {   
    // check if this is a valid position
    if (position<0 || position>_size) {
       return false;
    }
    
-   // determine if we need to grow the array
+   unshare();
+   
+   // determine if we need another segment
    if (_size == _capacity) {
-      Node * copiedItems = new Node[_capacity*2];
-      for (int i=0; i<_capacity; ++i) {
-         copiedItems[i] = _items[i];
-         if (i+_capacity+1<(_capacity+1)) {
-            copiedItems[i+_capacity] = Node(i+_capacity+1);
-         } else {
-            copiedItems[i+_capacity] = Node(NULL_VALUE);
-         }
-      }
-      
-      delete [] _items;
-      
-      _firstNewNodeIndex = _capacity;
-      _items = copiedItems;
-      _capacity *= 2;
+      grow(_capacity+1);
    }
    
    // determine the location of the new node
    int newNodeIndex = getNewNodeIndex();
-   _items[newNodeIndex].data = item;
+   itemAt(newNodeIndex) = item;
+   this->countCopies(1);
+   
+   // appending into the next physical slot keeps the list in order
+   if (position != _size || newNodeIndex != _size) {
+      _inOrder = false;
+   }
    
    // if this is the new head, then update _first;
    if (position==0) {
-      _items[newNodeIndex].next = _first;
+      nextAt(newNodeIndex) = _first;
       _first = newNodeIndex;
-      ++_size;
-      return true;
+   } else {
+      // go the correct position in the linked list
+      int previousPosition = findNodeIndex(position-1);
+      
+      // update the pointers to add the new item
+      nextAt(newNodeIndex) = nextAt(previousPosition);
+      nextAt(previousPosition) = newNodeIndex;
    }
    
-   // go the correct position in the linked list
-   int currentPosition = _first;
-   int previousPosition = NULL_VALUE;
-   for (int i=0; i<position; ++i) {
-      previousPosition = currentPosition;
-      currentPosition = _items[currentPosition].next;
-   }   
-   
-   // update the pointers to add the new item
-   _items[previousPosition].next = newNodeIndex;
-   _items[newNodeIndex].next = currentPosition;
-   
    // increment the size of the current list
    ++_size;
    
+   checkFragmentation(1);
+   
    return true;
 }
 
@@ -249,8 +441,8 @@ bool List<T>::insert(const T& item, const int& position) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::remove(const int& position) {
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::remove(const int& position) {
    // verify we can delete an element
    if (_size==0) {
       return false;
@@ -261,31 +453,352 @@ bool List<T>::remove(const int& position) {
       return false;
    }
    
+   unshare();
+   
+   // removing the last element leaves the others where they are
+   if (position != _size-1) {
+      _inOrder = false;
+   }
+   
    // the first item is a special case
    if (position==0) {
       int firstIndex = _first;
-      _first = _items[_first].next;
-      _items[firstIndex].next = _firstNewNodeIndex;
+      _first = nextAt(_first);
+      nextAt(firstIndex) = _firstNewNodeIndex;
       _firstNewNodeIndex = firstIndex;
    } else {
       // go the correct position in the linked list
-      int currentPosition = _first;
-      int previousPosition = NULL_VALUE;
-      for (int i=0; i<position; ++i) {
-         previousPosition = currentPosition;
-         currentPosition = _items[currentPosition].next;
-      }   
+      int previousPosition = findNodeIndex(position-1);
+      int currentPosition = nextAt(previousPosition);
       
-      _items[previousPosition].next = _items[currentPosition].next;
-      _items[currentPosition].next = _firstNewNodeIndex;
+      nextAt(previousPosition) = nextAt(currentPosition);
+      nextAt(currentPosition) = _firstNewNodeIndex;
       _firstNewNodeIndex = currentPosition;
    }
    
    --_size;
    
+   checkFragmentation(1);
+   
    return true;
 }
 
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are forward iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The array grows at most once and the list is
+ *    walked to position only once.
+ * 
+ * Worst-case Time Complexity: O(n+k), k being the number of items inserted
+ */
+template <class T, template <class> class Layout, class Stats>
+template <class Iterator>
+bool List<T, Layout, Stats>::insertRange(Iterator first, Iterator last,
+                                         const int& position) {
+   // check if this is a valid position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   int count = static_cast<int>(std::distance(first, last));
+   if (count<0) {
+      return false;
+   }
+   
+   unshare();
+   
+   // determine if we need more segments
+   if (count > _capacity-_size) {
+      grow(_size+count);
+   }
+   
+   // go the correct position in the linked list
+   int previousPosition = NULL_VALUE;
+   int currentPosition = _first;
+   if (position > 0) {
+      previousPosition = findNodeIndex(position-1);
+      currentPosition = nextAt(previousPosition);
+   }
+   
+   // link each new node in after the previous one
+   for (int i=position; first!=last; ++first, ++i) {
+      int newNodeIndex = getNewNodeIndex();
+      itemAt(newNodeIndex) = *first;
+      this->countCopies(1);
+      
+      if (position != _size || newNodeIndex != i) {
+         _inOrder = false;
+      }
+      
+      if (previousPosition == NULL_VALUE) {
+         _first = newNodeIndex;
+      } else {
+         nextAt(previousPosition) = newNodeIndex;
+      }
+      previousPosition = newNodeIndex;
+   }
+   
+   // reattach the rest of the list behind the last new node
+   if (previousPosition == NULL_VALUE) {
+      _first = currentPosition;
+   } else {
+      nextAt(previousPosition) = currentPosition;
+   }
+   
+   _size += count;
+   
+   checkFragmentation(count);
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed and their
+ *    nodes returned to the free list. The list is walked to from only once.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   if (from == to) {
+      return true;
+   }
+   
+   unshare();
+   
+   // removing a tail of the list leaves the others where they are
+   if (to != _size) {
+      _inOrder = false;
+   }
+   
+   // go the correct position in the linked list
+   int previousPosition = NULL_VALUE;
+   int currentPosition = _first;
+   if (from > 0) {
+      previousPosition = findNodeIndex(from-1);
+      currentPosition = nextAt(previousPosition);
+   }
+   
+   // find the last node to remove
+   int lastRemoved = currentPosition;
+   for (int i=from+1; i<to; ++i) {
+      lastRemoved = nextAt(lastRemoved);
+   }
+   this->countLinks(to-from-1);
+   
+   // bypass the removed nodes
+   if (previousPosition == NULL_VALUE) {
+      _first = nextAt(lastRemoved);
+   } else {
+      nextAt(previousPosition) = nextAt(lastRemoved);
+   }
+   
+   // the removed nodes are still chained together, so push them onto the
+   // free list as one block; they are then reused in their current order
+   nextAt(lastRemoved) = _firstNewNodeIndex;
+   _firstNewNodeIndex = currentPosition;
+   
+   _size -= to-from;
+   
+   checkFragmentation(to-from);
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare, equal elements in
+ *    the order they were in before. The nodes have been relinked by a
+ *    bottom-up merge sort, as in nodeSort.h, and no element has moved. The
+ *    list is usually out of physical order afterwards; compact() restores
+ *    it, and automatic compaction counts the sort as size changes.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, template <class> class Layout, class Stats>
+template <class Compare>
+void List<T, Layout, Stats>::sort(Compare compare) {
+   if (_size < 2) {
+      return;
+   }
+   
+   unshare();
+   
+   for (int length=1; length<_size; length*=2) {
+      int rest = _first;
+      int * link = &_first;
+      
+      // merge each pair of runs of length nodes onto the end of the chain
+      while (rest != NULL_VALUE) {
+         int left = rest;
+         int right = splitRun(left, length);
+         rest = splitRun(right, length);
+         
+         link = mergeRuns(left, right, link, compare);
+      }
+   }
+   
+   _inOrder = false;
+   checkFragmentation(_size);
+}
+
+/**
+ * Measure how scattered the list is through the node array
+ * 
+ * Precondition: N/A
+ * Postcondition: The fraction of consecutive pairs of elements that are not
+ *    stored in consecutive array slots is returned: 0 for a list laid out in
+ *    order, approaching 1 for one scattered across the array.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) if the list is known to be in order
+ */
+template <class T, template <class> class Layout, class Stats>
+double List<T, Layout, Stats>::getFragmentation() const {
+   if (_inOrder || _size < 2) {
+      return 0.0;
+   }
+   
+   int outOfOrderLinks = 0;
+   int currentPosition = _first;
+   for (int i=1; i<_size; ++i) {
+      int nextPosition = nextAt(currentPosition);
+      if (nextPosition != currentPosition+1) {
+         ++outOfOrderLinks;
+      }
+      currentPosition = nextPosition;
+   }
+   
+   return static_cast<double>(outOfOrderLinks)/(_size-1);
+}
+
+/**
+ * Relink the nodes of the list into physical order
+ * 
+ * Precondition: N/A
+ * Postcondition: The element at position i is stored at index i, and the
+ *    unused nodes follow in index order. Walking the list now reads the
+ *    segments front to back, and positions are found without a walk until
+ *    the order is next disturbed.
+ * 
+ * Worst-Case Time Complexity: O(capacity)
+ */
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::compact() {
+   unshare();
+   
+   if (!_inOrder) {
+      int segmentSize = 1 << _segmentShift;
+      Segment * copiedSegments = new(std::nothrow) Segment[_segmentSlots];
+      assert(copiedSegments != 0);
+      
+      for (int i=0; i<_segmentCount; ++i) {
+         copiedSegments[i] = Layout<T>::allocate(segmentSize);
+         this->countAllocation(Layout<T>::size(segmentSize));
+      }
+      
+      // copy the elements into the new segments in list order
+      int currentPosition = _first;
+      for (int i=0; i<_size; ++i) {
+         Layout<T>::item(copiedSegments[i >> _segmentShift],
+                         i & (segmentSize-1)) = itemAt(currentPosition);
+         currentPosition = nextAt(currentPosition);
+      }
+      this->countCopies(_size);
+      
+      int segmentCount = _segmentCount;
+      deleteSegments();
+      _segments = copiedSegments;
+      _segmentCount = segmentCount;
+   }
+   
+   // chain the list and then the free nodes through ascending indices
+   for (int i=0; i<_capacity; ++i) {
+      nextAt(i) = (i+1<_capacity ? i+1 : NULL_VALUE);
+   }
+   
+   if (_size > 0) {
+      _first = 0;
+      nextAt(_size-1) = NULL_VALUE;
+   } else {
+      _first = NULL_VALUE;
+   }
+   _firstNewNodeIndex = (_size<_capacity ? _size : NULL_VALUE);
+   
+   _inOrder = true;
+   _changesSinceCheck = 0;
+   
+   return true;
+}
+
+/**
+ * Enable or disable automatic compaction
+ * 
+ * Precondition: 0 <= threshold <= 1
+ * Postcondition: If autoCompact is true, the list measures its fragmentation
+ *    after every max(size, MIN_COMPACT_CHECK_INTERVAL) inserts and removes and
+ *    compacts itself when the fragmentation exceeds threshold.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::setAutoCompact(const bool& autoCompact,
+                                            const double& threshold) {
+   _autoCompact = autoCompact;
+   _compactThreshold = threshold;
+   _changesSinceCheck = 0;
+}
+
+/**
+ * Enable or disable copy-on-write copies
+ * 
+ * Precondition: N/A
+ * Postcondition: If copyOnWrite is true, copies of this list (by copy
+ *    construction or assignment) share its segments in O(1), and whichever
+ *    list is changed first makes its own copy of them then. If it is false,
+ *    the list has segments of its own and copies of it are deep copies.
+ * 
+ * Worst-Case Time Complexity: O(1); O(capacity) to turn copy-on-write off
+ *    while the segments are shared
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::setCopyOnWrite(const bool& copyOnWrite) {
+   if (copyOnWrite && _references==0) {
+      _references = new std::atomic<int>(1);
+   } else if (!copyOnWrite && _references!=0) {
+      unshare();
+      delete _references;
+      _references = 0;
+   }
+}
+
 /*****************************************************************************/
 /********************** Operators ********************************************/
 /*****************************************************************************/
@@ -295,24 +808,49 @@ bool List<T>::remove(const int& position) {
  * 
  * Preconditions: N/A
  * Postconditions: A copy of rhs has been assigned to this object. A const
- *    reference to this list is returned.
+ *    reference to this list is returned. If rhs is in copy-on-write mode,
+ *    this list now shares its segments and is in copy-on-write mode too.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(capacity); O(number of segments) in
+ *    copy-on-write mode
  */
-template <class T>
-const List<T>& List<T>::operator=(const List& rhs) {
+template <class T, template <class> class Layout, class Stats>
+const List<T, Layout, Stats>&
+List<T, Layout, Stats>::operator=(const List& rhs) {
    // verify this is not a self-assignment
    if (this == &rhs) { 
       return *this;
    }
    
+   // count the new reference first, in case both already share segments
+   if (rhs._references != 0) {
+      rhs._references->fetch_add(1);
+   }
+   releaseSegments();
+   _references = rhs._references;
+   
    _capacity = rhs._capacity;
    _first = rhs._first;
    _firstNewNodeIndex = rhs._firstNewNodeIndex;
    _size = rhs._size;
    
+   _inOrder = rhs._inOrder;
+   _autoCompact = rhs._autoCompact;
+   _compactThreshold = rhs._compactThreshold;
+   _changesSinceCheck = rhs._changesSinceCheck;
+   
+   _segmentShift = rhs._segmentShift;
+   _segmentCount = rhs._segmentCount;
+   _segmentSlots = rhs._segmentCount;
+   
+   if (_references != 0) {
+      _segments = rhs._segments;
+      _segmentSlots = rhs._segmentSlots;
+      return *this;
+   }
+   
    // copy rhs's elements into a new list
-   createCopyOfList(rhs._items, _items, _capacity);
+   createCopyOfList(rhs._segments, _segments, _segmentCount);
    
    return *this;
 }
@@ -321,25 +859,161 @@ const List<T>& List<T>::operator=(const List& rhs) {
 /********************** Input/Output *****************************************/
 /*****************************************************************************/
 
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, template <class> class Layout, class Stats>
+template <class Sink>
+bool List<T, Layout, Stats>::addItemsTo(Sink& sink) const {
+   int currentPosition = _first;
+   for (int i=0; i<_size; ++i) {
+      if (!sink.add(itemAt(currentPosition))) {
+         return false;
+      }
+      currentPosition = nextAt(currentPosition);
+   }
+   
+   return true;
+}
+
 /**
  * Output the list
  * 
- * Precondition: The ostream, out, is open.
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
  * Postcondition: The list represented by this List object has been inserted
- *    into out.
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::display(std::ostream& out,
+                                     const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Write the list to a binary list file
+ * 
+ * Precondition: out is open in binary mode; T is trivially copyable
+ * Postcondition: The list has been written to out in the format of
+ *    listFile.h. The elements are gathered in list order into blocks of
+ *    about LIST_FILE_BLOCK_SIZE bytes, each written at once. Return true if
+ *    out is still good, and false otherwise.
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-void List<T>::display(std::ostream& out) const {
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::write(std::ostream& out) const {
+   if (!writeListFileHeader<T>(out, _size)) {
+      return false;
+   }
+   
+   int blockLength = static_cast<int>(LIST_FILE_BLOCK_SIZE/sizeof(T));
+   if (blockLength < 1) {
+      blockLength = 1;
+   }
+   T * block = static_cast<T *>(::operator new(blockLength*sizeof(T),
+                                               std::nothrow));
+   assert(block != 0);
+   
+   bool good = true;
    int currentPosition = _first;
-   for (int i=0; i<_size; ++i) {
-      out << _items[currentPosition].data;
-      if (i+1<_size) {
-         out << " ";
+   for (int i=0; i<_size && good; i+=blockLength) {
+      int length = (_size-i<blockLength ? _size-i : blockLength);
+      for (int j=0; j<length; ++j) {
+         std::memcpy(block+j, &itemAt(currentPosition), sizeof(T));
+         currentPosition = nextAt(currentPosition);
+      }
+      good = writeListFileItems(out, block, length);
+   }
+   
+   ::operator delete(block);
+   
+   return good;
+}
+
+/**
+ * Replace the list with one read from a binary list file
+ * 
+ * Precondition: in is open in binary mode; T is trivially copyable
+ * Postcondition: If in held a list file of T elements, as written by write,
+ *    the list holds its elements, read in blocks of about
+ *    LIST_FILE_BLOCK_SIZE bytes, and true is returned. The list is then in
+ *    order, as after compact(). If the header was not valid, or in is too
+ *    short for the elements it claims, false is returned and the list is
+ *    unchanged; if in ended before the last element all the same, false is
+ *    returned and the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(capacity + k), k being the number of
+ *    elements read
+ */
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::read(std::istream& in) {
+   int count = 0;
+   if (!readListFileHeader<T>(in, count)) {
+      return false;
+   }
+   
+   unshare();
+   
+   if (count > _capacity) {
+      grow(count);
+   }
+   
+   int blockLength = static_cast<int>(LIST_FILE_BLOCK_SIZE/sizeof(T));
+   if (blockLength < 1) {
+      blockLength = 1;
+   }
+   T * block = static_cast<T *>(::operator new(blockLength*sizeof(T),
+                                               std::nothrow));
+   assert(block != 0);
+   
+   // element i goes to index i, linked to index i+1
+   bool complete = true;
+   for (int i=0; i<count && complete; i+=blockLength) {
+      int length = (count-i<blockLength ? count-i : blockLength);
+      complete = readListFileItems(in, block, length);
+      for (int j=0; j<length; ++j) {
+         std::memcpy(&itemAt(i+j), block+j, sizeof(T));
+         nextAt(i+j) = i+j+1;
       }
-      currentPosition = _items[currentPosition].next;
    }
+   
+   ::operator delete(block);
+   
+   if (!complete) {
+      count = 0;
+   }
+   
+   // the unused nodes follow in index order, as after compact()
+   for (int i=count; i<_capacity; ++i) {
+      nextAt(i) = (i+1<_capacity ? i+1 : NULL_VALUE);
+   }
+   
+   if (count > 0) {
+      _first = 0;
+      nextAt(count-1) = NULL_VALUE;
+   } else {
+      _first = NULL_VALUE;
+   }
+   _firstNewNodeIndex = (count<_capacity ? count : NULL_VALUE);
+   
+   _size = count;
+   _inOrder = true;
+   _changesSinceCheck = 0;
+   
+   return complete;
 }
 
 /**
@@ -351,8 +1025,9 @@ void List<T>::display(std::ostream& out) const {
  * 
  * Worst-Case Time Comlexity: O(n)
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& out, const List<T>& list) {
+template <typename T, template <class> class Layout, class Stats>
+std::ostream& operator<<(std::ostream& out,
+                         const List<T, Layout, Stats>& list) {
    list.display(out);
    
    return out;
@@ -362,6 +1037,36 @@ std::ostream& operator<<(std::ostream& out, const List<T>& list) {
 /********************** Private Functions ************************************/
 /*****************************************************************************/
 
+/**
+ * Get the element stored at an index
+ * 
+ * Precondition: 0 <= index < capacity
+ * Postcondition: A reference to the element of the node at index is
+ *    returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Layout, class Stats>
+T & List<T, Layout, Stats>::itemAt(const int& index) const {
+   return Layout<T>::item(_segments[index >> _segmentShift],
+                          index & ((1 << _segmentShift)-1));
+}
+
+/**
+ * Get the next index stored at an index
+ * 
+ * Precondition: 0 <= index < capacity
+ * Postcondition: A reference to the index of the node following the node at
+ *    index is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Layout, class Stats>
+int & List<T, Layout, Stats>::nextAt(const int& index) const {
+   return Layout<T>::next(_segments[index >> _segmentShift],
+                          index & ((1 << _segmentShift)-1));
+}
+
 /**
  * Returns the index of the next new node. Repositions the pointer to the next
  * new node
@@ -369,45 +1074,309 @@ std::ostream& operator<<(std::ostream& out, const List<T>& list) {
  * Precondition: There are available nodes in the linked list.
  * Postcondition: An index of an available node is returned. That index is now
  *    allocated as a used node
- *
+ * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getNewNodeIndex() {
+template <class T, template <class> class Layout, class Stats>
+int List<T, Layout, Stats>::getNewNodeIndex() {
    if (_firstNewNodeIndex==NULL_VALUE) {
       return NULL_VALUE;
    }
    
    int nodeIndex = _firstNewNodeIndex;
-   _firstNewNodeIndex = _items[_firstNewNodeIndex].next;
+   _firstNewNodeIndex = nextAt(_firstNewNodeIndex);
    
    return nodeIndex;
 }
 
+/**
+ * Find the index of the node at the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: The index of the node holding the element at position is
+ *    returned.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) while the list is in order
+ */
+template <class T, template <class> class Layout, class Stats>
+int List<T, Layout, Stats>::findNodeIndex(const int& position) const {
+   if (_inOrder) {
+      return position;
+   }
+   
+   int currentPosition = _first;
+   for (int i=0; i<position; ++i) {
+      currentPosition = nextAt(currentPosition);
+   }
+   this->countLinks(position);
+   
+   return currentPosition;
+}
+
+/**
+ * Cut a run of nodes off the front of a chain
+ * 
+ * Precondition: first is the index of the first node of a chain, or
+ *    NULL_VALUE; length > 0
+ * Postcondition: The chain has been cut after its first length nodes (or
+ *    left whole if it is shorter), and the index of the first node after the
+ *    cut, or NULL_VALUE, is returned.
+ * 
+ * Worst-Case Time Complexity: O(length)
+ */
+template <class T, template <class> class Layout, class Stats>
+int List<T, Layout, Stats>::splitRun(int first, const int& length) {
+   for (int i=1; first!=NULL_VALUE && i<length; ++i) {
+      first = nextAt(first);
+   }
+   
+   if (first == NULL_VALUE) {
+      return NULL_VALUE;
+   }
+   
+   int rest = nextAt(first);
+   nextAt(first) = NULL_VALUE;
+   
+   return rest;
+}
+
+/**
+ * Merge two sorted chains of nodes
+ * 
+ * Precondition: left and right are the first indices of chains sorted by
+ *    compare, either may be NULL_VALUE; link is where the merged chain is to
+ *    be linked
+ * Postcondition: *link is the index of the first node of the merged chain,
+ *    in which nodes from left come before equal ones from right. The link
+ *    field of its last node is returned.
+ * 
+ * Worst-Case Time Complexity: O(length of left + length of right)
+ */
+template <class T, template <class> class Layout, class Stats>
+template <class Compare>
+int * List<T, Layout, Stats>::mergeRuns(int left, int right, int * link,
+                                        Compare& compare) {
+   while (left!=NULL_VALUE && right!=NULL_VALUE) {
+      if (compare(itemAt(right), itemAt(left))) {
+         *link = right;
+         right = nextAt(right);
+      } else {
+         *link = left;
+         left = nextAt(left);
+      }
+      link = &nextAt(*link);
+   }
+   
+   *link = (left != NULL_VALUE ? left : right);
+   while (*link != NULL_VALUE) {
+      link = &nextAt(*link);
+   }
+   
+   return link;
+}
+
+/**
+ * Record changes to the list and compact it if it has become too fragmented
+ * 
+ * Precondition: changes is the number of elements just inserted or removed
+ * Postcondition: If automatic compaction is enabled and enough changes have
+ *    accumulated, the fragmentation has been measured and the list compacted
+ *    if it exceeds the threshold.
+ * 
+ * Worst-Case Time Complexity: O(capacity); amortized O(1) per change
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::checkFragmentation(const int& changes) {
+   if (!_autoCompact || _inOrder) {
+      return;
+   }
+   
+   _changesSinceCheck += changes;
+   
+   int interval = (_size>MIN_COMPACT_CHECK_INTERVAL ?
+                   _size : MIN_COMPACT_CHECK_INTERVAL);
+   if (_changesSinceCheck < interval) {
+      return;
+   }
+   
+   _changesSinceCheck = 0;
+   
+   if (getFragmentation() > _compactThreshold) {
+      compact();
+   }
+}
+
 /**
  * Copy a linked list
  * 
- * Precondition: originalList is the list to be copied. copiedList is 
- *   where the copy should be located.
- * Postcondition: copiedList points to a copy of originalList
+ * Precondition: originalSegments holds the segments of the list to be copied.
+ *    copiedSegments is where the copy should be located and holds no
+ *    segments of its own. _segmentShift matches the original list.
+ * Postcondition: copiedSegments points to a copy of originalSegments, with
+ *    every node at the same index as in the original
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(capacity)
  */
-template <class T>
-bool List<T>::createCopyOfList(Node * originalList, 
-                               Node * &copiedList,
-                               const int& capacity) {
-   if (copiedList == 0) {
-      delete [] copiedList;
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::createCopyOfList(Segment * originalSegments, 
+                                              Segment * &copiedSegments,
+                                              const int& segmentCount) {
+   int segmentSize = 1 << _segmentShift;
+   
+   copiedSegments = new(std::nothrow) Segment[segmentCount];
+   assert(copiedSegments != 0);
+   
+   for (int i=0; i<segmentCount; ++i) {
+      copiedSegments[i] = Layout<T>::allocate(segmentSize);
+      this->countAllocation(Layout<T>::size(segmentSize));
+      
+      for (int j=0; j<segmentSize; ++j) {
+         Layout<T>::item(copiedSegments[i], j) =
+            Layout<T>::item(originalSegments[i], j);
+         Layout<T>::next(copiedSegments[i], j) =
+            Layout<T>::next(originalSegments[i], j);
+      }
    }
+   this->countCopies(segmentCount*segmentSize);
    
-   copiedList = new Node[capacity];
+   return true;
+}
+
+/**
+ * Add segments of nodes until the list has at least newCapacity nodes
+ * 
+ * Precondition: newCapacity > capacity
+ * Postcondition: Enough segments have been added for newCapacity nodes. The
+ *    added nodes are chained in ascending order onto the front of the free
+ *    list. Existing nodes have not moved; only the table of segment pointers
+ *    is ever copied.
+ * 
+ * Worst-Case Time Complexity: O(newCapacity - capacity), plus O(number of
+ *    segments) when the segment table itself has to grow
+ */
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::grow(const int& newCapacity) {
+   int segmentSize = 1 << _segmentShift;
+   int oldCapacity = _capacity;
+   
+   while (_capacity < newCapacity) {
+      // double the table of segment pointers when it is full
+      if (_segmentCount == _segmentSlots) {
+         int newSlots = (_segmentSlots>0 ? _segmentSlots*2 : 1);
+         Segment * copiedSegments = new(std::nothrow) Segment[newSlots];
+         assert(copiedSegments != 0);
+         
+         for (int i=0; i<_segmentCount; ++i) {
+            copiedSegments[i] = _segments[i];
+         }
+         
+         delete [] _segments;
+         _segments = copiedSegments;
+         _segmentSlots = newSlots;
+      }
+      
+      _segments[_segmentCount] = Layout<T>::allocate(segmentSize);
+      this->countAllocation(Layout<T>::size(segmentSize));
+      
+      ++_segmentCount;
+      _capacity += segmentSize;
+   }
+   
+   // chain the new nodes together, ending with the old free list
+   for (int i=oldCapacity; i<_capacity; ++i) {
+      if (i+1<_capacity) {
+         nextAt(i) = i+1;
+      } else {
+         nextAt(i) = _firstNewNodeIndex;
+      }
+   }
+   
+   _firstNewNodeIndex = oldCapacity;
+   
+   return true;
+}
+
+/**
+ * Return every segment, and the segment table, to the heap
+ * 
+ * Precondition: N/A
+ * Postcondition: The list has no nodes allocated and _segments is 0. The
+ *    caller is responsible for resetting the remaining members.
+ * 
+ * Worst-Case Time Complexity: O(number of segments)
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::deleteSegments() {
+   for (int i=0; i<_segmentCount; ++i) {
+      Layout<T>::deallocate(_segments[i]);
+   }
+   
+   delete [] _segments;
+   
+   _segments = 0;
+   _segmentCount = 0;
+}
+
+/**
+ * Give the list segments of its own if it shares them
+ * 
+ * Precondition: N/A
+ * Postcondition: If the segments were shared with another list, the list now
+ *    holds a copy of them, with every node at the same index, and true is
+ *    returned. Otherwise nothing has changed and false is returned.
+ * 
+ * Worst-Case Time Complexity: O(capacity); O(1) if the segments are not
+ *    shared
+ */
+template <class T, template <class> class Layout, class Stats>
+bool List<T, Layout, Stats>::unshare() {
+   if (!isShared()) {
+      return false;
+   }
    
-   for (int i=0; i<capacity; ++i) {
-      copiedList[i] = originalList[i];
+   Segment * copiedSegments = 0;
+   createCopyOfList(_segments, copiedSegments, _segmentCount);
+   
+   // the other lists may have let go of the segments in the meantime
+   if (_references->fetch_sub(1) == 1) {
+      int segmentCount = _segmentCount;
+      deleteSegments();
+      _segmentCount = segmentCount;
+      _references->store(1);
+   } else {
+      _references = new std::atomic<int>(1);
    }
    
+   _segments = copiedSegments;
+   _segmentSlots = _segmentCount;
+   
    return true;
 }
 
+/**
+ * Let go of the segments
+ * 
+ * Precondition: N/A
+ * Postcondition: The segments and the segment table have been returned to
+ *    the heap, unless other lists still share them. The list has no
+ *    segments; the caller is responsible for resetting the remaining
+ *    members, _references included.
+ * 
+ * Worst-Case Time Complexity: O(number of segments); O(1) if other lists
+ *    share the segments
+ */
+template <class T, template <class> class Layout, class Stats>
+void List<T, Layout, Stats>::releaseSegments() {
+   if (_references != 0) {
+      if (_references->fetch_sub(1) != 1) {
+         _segments = 0;
+         _segmentCount = 0;
+         return;
+      }
+      delete _references;
+   }
+   
+   deleteSegments();
+}
+
 #endif /*ARRAY_LINKED_LIST_H_*/
\ No newline at end of file
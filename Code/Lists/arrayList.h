@@ -1,30 +1,98 @@
 #ifndef ARRAY_LIST_H_
 #define ARRAY_LIST_H_
 
+#include <functional>
 #include <iostream>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
 
+#include "arraySearch.h"
+#include "arraySort.h"
+#include "listStats.h"
+#include "listWriter.h"
+
+// the capacity of a List<T> when none is given
 const int CAPACITY = 1024;
 
-template <typename T> class List;
-template <typename T> std::ostream& operator<<(std::ostream&, const List<T>&);
+// ARRAY_LIST_CONSTANT_EVALUATED() is true while a constexpr function is being
+// evaluated at compile time, where memmove cannot be used
+#if defined(__cpp_lib_is_constant_evaluated)
+#define ARRAY_LIST_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__GNUC__) || defined(__clang__)
+#define ARRAY_LIST_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define ARRAY_LIST_CONSTANT_EVALUATED() true
+#endif
 
-template <class T>
-class List {
-   public:
-      List();
-      
-      int getSize() const;
-      int getCapacity() const;
+// C++20 lets a constexpr constructor leave the element array uninitialized;
+// before that it must value-initialize (zero) all N elements
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201907L
+#define ARRAY_LIST_UNINITIALIZED_ITEMS 1
+#else
+#define ARRAY_LIST_UNINITIALIZED_ITEMS 0
+#endif
 
-      bool isEmpty() const;
-      bool insert(const T&, const int&);
-      bool remove(const int&);
+template <typename T, int N = CAPACITY, class Stats = LIST_STATS>
+class List;
+template <typename T, int N, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, N, Stats>&);
 
-      void display(std::ostream&) const;
-      friend std::ostream& operator<< <>(std::ostream&, const List<T>&);
+/**
+ * A list held in a fixed array of N elements, usable in constant
+ * expressions for a literal T.
+ * 
+ * Being constexpr, the constructors must give every element a value when a
+ * list is built at compile time. From C++20 they only do so then, and a list
+ * built at run time leaves its free elements as default-initialized as a
+ * plain array would. Compiled as C++17, where a constexpr constructor must
+ * initialize every member, they value-initialize all N elements every time,
+ * so constructing a list costs O(N).
+ */
+template <class T, int N, class Stats>
+class List : private Stats {
+   public:
+      constexpr List();
+      constexpr List(const List&);
+      
+      constexpr int getSize() const;
+      constexpr int getCapacity() const;
+      constexpr const Stats& getStats() const;
+      
+      constexpr bool isEmpty() const;
+      
+      constexpr int find(const T&, const int&) const;
+      constexpr int indexOf(const T&) const;
+      constexpr int count(const T&) const;
+      constexpr bool contains(const T&) const;
+      
+      constexpr bool insert(const T&, const int&);
+      constexpr bool remove(const int&);
+      
+      template <class Iterator>
+      constexpr bool insertRange(Iterator, Iterator, const int&);
+      constexpr bool removeRange(const int&, const int&);
+      
+      constexpr void sort();
+      template <class Compare>
+      constexpr void sort(Compare);
+      
+      constexpr const T& operator[](const int&) const;
+      constexpr T& operator[](const int&);
+      constexpr const List& operator=(const List&);
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = false;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
    private:
-      T _items[CAPACITY]; // array to store list elements
+      T _items[N]; // array to store list elements
       int _size; // current size of the list stored in _items
+      
+      constexpr void shiftItems(const int&, const int&, const int&);
 };
 
 /*****************************************************************************/
@@ -37,12 +105,61 @@ class List {
  * Precondition: N/A
  * Postcondition: An empty list, with size indicated as 0
  * 
- * Worst-Case Time Complexity: O(1)
+ * Worst-Case Time Complexity: O(1) at run time from C++20; O(N) at compile
+ *    time, and always before C++20
+ */
+#if ARRAY_LIST_UNINITIALIZED_ITEMS
+template <class T, int N, class Stats>
+constexpr List<T, N, Stats>::List() : _size(0) {
+   // a constant expression may not hold indeterminate values
+   if (ARRAY_LIST_CONSTANT_EVALUATED()) {
+      for (int i=0; i<N; ++i) {
+         _items[i] = T();
+      }
+   }
+}
+#else
+template <class T, int N, class Stats>
+constexpr List<T, N, Stats>::List() : _items(), _size(0) {
+}
+#endif
+
+/**
+ * Construct a copy of a List object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A copy of originalList has been constructed. Its counters
+ *    start at zero rather than being copied (see listStats.h), and the
+ *    elements copied are counted.
+ * 
+ * Worst-Case Time Complexity: O(n) at run time from C++20; O(N) at compile
+ *    time, and always before C++20
  */
-template <class T>
-List<T>::List() {
-   _size = 0;
+#if ARRAY_LIST_UNINITIALIZED_ITEMS
+template <class T, int N, class Stats>
+constexpr List<T, N, Stats>::List(const List& originalList)
+   : Stats(), _size(originalList._size) {
+   for (int i=0; i<_size; ++i) {
+      _items[i] = originalList._items[i];
+   }
+   if (ARRAY_LIST_CONSTANT_EVALUATED()) {
+      for (int i=_size; i<N; ++i) {
+         _items[i] = T();
+      }
+   }
+   this->countCopies(_size);
+}
+#else
+template <class T, int N, class Stats>
+constexpr List<T, N, Stats>::List(const List& originalList)
+   : Stats(), _items(), _size(originalList._size) {
+   for (int i=0; i<_size; ++i) {
+      _items[i] = originalList._items[i];
+   }
+   this->countCopies(_size);
 }
+#endif
 
 /*****************************************************************************/
 /********************** Accessors ********************************************/
@@ -56,8 +173,8 @@ List<T>::List() {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getSize() const {
+template <class T, int N, class Stats>
+constexpr int List<T, N, Stats>::getSize() const {
    return _size;
 }
 
@@ -69,9 +186,23 @@ int List<T>::getSize() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getCapacity() const {
-   return CAPACITY;
+template <class T, int N, class Stats>
+constexpr int List<T, N, Stats>::getCapacity() const {
+   return N;
+}
+
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+constexpr const Stats& List<T, N, Stats>::getStats() const {
+   return *this;
 }
 
 /**
@@ -82,11 +213,83 @@ int List<T>::getCapacity() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-bool List<T>::isEmpty() const {
+template <class T, int N, class Stats>
+constexpr bool List<T, N, Stats>::isEmpty() const {
    return _size==0;
 }
 
+/**
+ * Find an item, starting from a position
+ * 
+ * Precondition: 0 <= start <= size
+ * Postcondition: The first position at or after start holding an element
+ *    equal to item is returned, or -1 if there is none or start is out of
+ *    range. Arithmetic elements are compared a vector at a time (see
+ *    arraySearch.h), except during compile-time evaluation.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+constexpr int List<T, N, Stats>::find(const T& item, const int& start) const {
+   if (start<0 || start>_size) {
+      return -1;
+   }
+   
+   int position = -1;
+   if (ARRAY_LIST_CONSTANT_EVALUATED()) {
+      position = findItemScalar(_items+start, _size-start, item);
+   } else {
+      position = findItem(_items+start, _size-start, item);
+   }
+   
+   return position < 0 ? -1 : start+position;
+}
+
+/**
+ * Find the first occurrence of an item
+ * 
+ * Precondition: N/A
+ * Postcondition: The position of the first element equal to item is
+ *    returned, or -1 if there is none.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+constexpr int List<T, N, Stats>::indexOf(const T& item) const {
+   return find(item, 0);
+}
+
+/**
+ * Count the occurrences of an item
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements equal to item is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+constexpr int List<T, N, Stats>::count(const T& item) const {
+   if (ARRAY_LIST_CONSTANT_EVALUATED()) {
+      return countItemsScalar(_items, _size, item);
+   }
+   
+   return countItems(_items, _size, item);
+}
+
+/**
+ * Check if the list holds an item
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if an element equal to item is in the list and
+ *    false otherwise
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+constexpr bool List<T, N, Stats>::contains(const T& item) const {
+   return find(item, 0) >= 0;
+}
+
 /*****************************************************************************/
 /********************** Functions ********************************************/
 /*****************************************************************************/
@@ -100,9 +303,9 @@ bool List<T>::isEmpty() const {
  * 
  * Worst-case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::insert(const T& item, const int& position) {
-   if (_size == CAPACITY) {
+template <class T, int N, class Stats>
+constexpr bool List<T, N, Stats>::insert(const T& item, const int& position) {
+   if (_size == N) {
       return false;
    }
    
@@ -111,12 +314,11 @@ bool List<T>::insert(const T& item, const int& position) {
    }
    
    // shift elements to the right to make space for the new element
-   for (int i=_size; i>position; --i) {
-      _items[i] = _items[i-1];
-   }
+   shiftItems(position, position+1, _size-position);
    
    // put the new element in the correct position
    _items[position]=item;
+   this->countCopies(1);
    
    // increment the size of the current list
    ++_size;
@@ -132,8 +334,8 @@ bool List<T>::insert(const T& item, const int& position) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::remove(const int& position) {
+template <class T, int N, class Stats>
+constexpr bool List<T, N, Stats>::remove(const int& position) {
    // verify we can delete an element
    if (_size==0) {
       return false;
@@ -145,36 +347,208 @@ bool List<T>::remove(const int& position) {
    }
    
    // shift the array left
-   for (int i=position; i<_size; ++i) {
-      _items[i]=_items[i+1];
-   }
+   shiftItems(position+1, position, _size-position-1);
    
    --_size;
    
    return true;
 }
 
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are forward iterators delimiting the items to
+ *    be inserted; there is room in the array for all of them;
+ *    0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The elements after position are shifted only
+ *    once. Returns false, leaving the list unchanged, if the position is
+ *    invalid or the items do not fit.
+ * 
+ * Worst-case Time Complexity: O(n+k), k being the number of items inserted
+ */
+template <class T, int N, class Stats>
+template <class Iterator>
+constexpr bool List<T, N, Stats>::insertRange(Iterator first, Iterator last,
+                                              const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   int count = static_cast<int>(std::distance(first, last));
+   if (count<0 || count > N-_size) {
+      return false;
+   }
+   
+   // shift elements to the right to make space for all of the new elements
+   shiftItems(position, position+count, _size-position);
+   
+   // copy the new elements into the gap
+   for (int i=position; first!=last; ++first, ++i) {
+      _items[i] = *first;
+   }
+   this->countCopies(count);
+   
+   _size += count;
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. The elements
+ *    after them are shifted left only once.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+constexpr bool List<T, N, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   // shift the array left over the removed elements
+   int count = to-from;
+   shiftItems(to, from, _size-to);
+   
+   _size -= count;
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, int N, class Stats>
+constexpr void List<T, N, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare. Equal elements may
+ *    have changed order. The list is sorted in place by introsort (see
+ *    arraySort.h).
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, int N, class Stats>
+template <class Compare>
+constexpr void List<T, N, Stats>::sort(Compare compare) {
+   sortItems(_items, _size, compare);
+}
+
 /*****************************************************************************/
-/********************** Input/Output *****************************************/
+/********************** Operators ********************************************/
 /*****************************************************************************/
 
 /**
- * Output the list
+ * Access the item at the specified position
  * 
- * Precondition: The ostream, out, is open.
- * Postcondition: The list represented by this List object has been inserted
- *    into out.
+ * Preconditions: 0 <= position < size
+ * Postconditions: A const reference to the element at position is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+constexpr const T& List<T, N, Stats>::operator[](const int& position) const {
+   return _items[position];
+}
+
+/**
+ * Access the item at the specified position
+ * 
+ * Preconditions: 0 <= position < size
+ * Postconditions: A reference to the element at position is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+constexpr T& List<T, N, Stats>::operator[](const int& position) {
+   return _items[position];
+}
+
+/**
+ * Assign a copy of a list object to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: A copy of rhs has been assigned to this object. A const
+ *    reference to this list is returned. This list keeps its own counters,
+ *    to which the elements copied are added.
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-void List<T>::display(std::ostream& out) const {
+template <class T, int N, class Stats>
+constexpr const List<T, N, Stats>& List<T, N, Stats>::operator=(
+      const List& rhs) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   for (int i=0; i<rhs._size; ++i) {
+      _items[i] = rhs._items[i];
+   }
+   _size = rhs._size;
+   this->countCopies(_size);
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, int N, class Stats>
+template <class Sink>
+bool List<T, N, Stats>::addItemsTo(Sink& sink) const {
    for (int i=0; i<_size; ++i) {
-      out << _items[i];
-      if (i+1<_size) {
-         out << " ";
+      if (!sink.add(_items[i])) {
+         return false;
       }
    }
+   
+   return true;
+}
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this List object has been inserted
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, int N, class Stats>
+void List<T, N, Stats>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
 }
 
 /**
@@ -186,11 +560,50 @@ void List<T>::display(std::ostream& out) const {
  * 
  * Worst-Case Time Comlexity: O(n)
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& out, const List<T>& list) {
+template <typename T, int N, class Stats>
+std::ostream& operator<<(std::ostream& out, const List<T, N, Stats>& list) {
    list.display(out);
    
    return out;
 }
 
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Move a block of elements within the array
+ * 
+ * Precondition: [from, from+count) and [to, to+count) both lie within the
+ *    array; they may overlap
+ * Postcondition: The count elements that started at from are now at to.
+ *    Trivially copyable elements are moved with a single memmove, except
+ *    during compile-time evaluation.
+ * 
+ * Worst-Case Time Complexity: O(count)
+ */
+template <class T, int N, class Stats>
+constexpr void List<T, N, Stats>::shiftItems(const int& from, const int& to,
+                                             const int& count) {
+   if (count <= 0 || from == to) {
+      return;
+   }
+   
+   this->countShifts(count);
+   
+   if (std::is_trivially_copyable<T>::value &&
+       !ARRAY_LIST_CONSTANT_EVALUATED()) {
+      std::memmove(static_cast<void *>(_items+to), _items+from,
+                   count*sizeof(T));
+   } else if (to < from) {
+      for (int i=0; i<count; ++i) {
+         _items[to+i] = _items[from+i];
+      }
+   } else {
+      for (int i=count-1; i>=0; --i) {
+         _items[to+i] = _items[from+i];
+      }
+   }
+}
+
 #endif /*ARRAY_LIST_H_*/
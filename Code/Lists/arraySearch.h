@@ -0,0 +1,440 @@
+#ifndef ARRAY_SEARCH_H_
+#define ARRAY_SEARCH_H_
+
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Linear search over the elements of an array-backed list.
+ * 
+ * findItem and countItems compare items with operator==. For integral and
+ * floating-point T on x86 they compare a whole vector of elements at a time:
+ * 32 bytes per instruction when compiled with AVX2 (-mavx2 or -march=...),
+ * 16 bytes with SSE2 otherwise. The vector comparisons have the same meaning
+ * as ==, so NaN matches nothing and 0.0 matches -0.0. Every other T, and
+ * every T on other processors, goes through the plain loops, which are
+ * constexpr so that constexpr lists can search at compile time.
+ */
+
+/*****************************************************************************/
+/********************** Scalar Search ****************************************/
+/*****************************************************************************/
+
+/**
+ * Find the first element equal to item, one element at a time
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: The position of the first element equal to item is
+ *    returned, or -1 if there is none.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+constexpr int findItemScalar(const T * items, const int& count,
+                             const T& item) {
+   for (int i=0; i<count; ++i) {
+      if (items[i] == item) {
+         return i;
+      }
+   }
+   
+   return -1;
+}
+
+/**
+ * Count the elements equal to item, one element at a time
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: The number of elements equal to item is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+constexpr int countItemsScalar(const T * items, const int& count,
+                               const T& item) {
+   int matches = 0;
+   for (int i=0; i<count; ++i) {
+      if (items[i] == item) {
+         ++matches;
+      }
+   }
+   
+   return matches;
+}
+
+/*****************************************************************************/
+/********************** Vector Lanes *****************************************/
+/*****************************************************************************/
+
+/**
+ * How to compare a vector of T at once. Types without a specialization have
+ * no vector comparison. Each specialization gives
+ * 
+ *    broadcast(item)     a vector with item in every lane
+ *    equal(a, b)         a vector whose lanes are all ones where a and b are
+ *                        equal and all zeros elsewhere
+ */
+template <class T, int Size = sizeof(T),
+          bool Integral = std::is_integral<T>::value>
+class SearchLanes {
+   public:
+      typedef std::false_type Vectorized;
+};
+
+#if defined(__AVX2__)
+
+typedef __m256i SearchVector;
+const int SEARCH_VECTOR_BYTES = 32;
+
+inline SearchVector loadSearchVector(const void * items) {
+   return _mm256_loadu_si256(static_cast<const __m256i *>(items));
+}
+
+inline SearchVector orSearchVectors(const SearchVector& a,
+                                    const SearchVector& b) {
+   return _mm256_or_si256(a, b);
+}
+
+// one bit per byte of the vector, set where the byte is all ones
+inline unsigned int searchMask(const SearchVector& equal) {
+   return static_cast<unsigned int>(_mm256_movemask_epi8(equal));
+}
+
+inline SearchVector zeroSearchVector() {
+   return _mm256_setzero_si256();
+}
+
+// add one to each byte of counts where equal is all ones
+inline SearchVector addMatchingBytes(const SearchVector& counts,
+                                     const SearchVector& equal) {
+   return _mm256_sub_epi8(counts, equal);
+}
+
+inline long long sumMatchingBytes(const SearchVector& counts) {
+   long long sums[4];
+   _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums),
+                       _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+   
+   return sums[0]+sums[1]+sums[2]+sums[3];
+}
+
+template <class T>
+class SearchLanes<T, 1, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm256_set1_epi8(static_cast<char>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm256_cmpeq_epi8(a, b);
+      }
+};
+
+template <class T>
+class SearchLanes<T, 2, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm256_set1_epi16(static_cast<short>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm256_cmpeq_epi16(a, b);
+      }
+};
+
+template <class T>
+class SearchLanes<T, 4, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm256_set1_epi32(static_cast<int>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm256_cmpeq_epi32(a, b);
+      }
+};
+
+template <class T>
+class SearchLanes<T, 8, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm256_set1_epi64x(static_cast<long long>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm256_cmpeq_epi64(a, b);
+      }
+};
+
+template <>
+class SearchLanes<float, 4, false> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const float& item) {
+         return _mm256_castps_si256(_mm256_set1_ps(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a),
+                                                  _mm256_castsi256_ps(b),
+                                                  _CMP_EQ_OQ));
+      }
+};
+
+template <>
+class SearchLanes<double, 8, false> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const double& item) {
+         return _mm256_castpd_si256(_mm256_set1_pd(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a),
+                                                  _mm256_castsi256_pd(b),
+                                                  _CMP_EQ_OQ));
+      }
+};
+
+#elif defined(__SSE2__)
+
+typedef __m128i SearchVector;
+const int SEARCH_VECTOR_BYTES = 16;
+
+inline SearchVector loadSearchVector(const void * items) {
+   return _mm_loadu_si128(static_cast<const __m128i *>(items));
+}
+
+inline SearchVector orSearchVectors(const SearchVector& a,
+                                    const SearchVector& b) {
+   return _mm_or_si128(a, b);
+}
+
+// one bit per byte of the vector, set where the byte is all ones
+inline unsigned int searchMask(const SearchVector& equal) {
+   return static_cast<unsigned int>(_mm_movemask_epi8(equal));
+}
+
+inline SearchVector zeroSearchVector() {
+   return _mm_setzero_si128();
+}
+
+// add one to each byte of counts where equal is all ones
+inline SearchVector addMatchingBytes(const SearchVector& counts,
+                                     const SearchVector& equal) {
+   return _mm_sub_epi8(counts, equal);
+}
+
+inline long long sumMatchingBytes(const SearchVector& counts) {
+   long long sums[2];
+   _mm_storeu_si128(reinterpret_cast<__m128i *>(sums),
+                    _mm_sad_epu8(counts, _mm_setzero_si128()));
+   
+   return sums[0]+sums[1];
+}
+
+template <class T>
+class SearchLanes<T, 1, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm_set1_epi8(static_cast<char>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm_cmpeq_epi8(a, b);
+      }
+};
+
+template <class T>
+class SearchLanes<T, 2, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm_set1_epi16(static_cast<short>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm_cmpeq_epi16(a, b);
+      }
+};
+
+template <class T>
+class SearchLanes<T, 4, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm_set1_epi32(static_cast<int>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm_cmpeq_epi32(a, b);
+      }
+};
+
+template <class T>
+class SearchLanes<T, 8, true> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const T& item) {
+         return _mm_set1_epi64x(static_cast<long long>(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+#if defined(__SSE4_1__)
+         return _mm_cmpeq_epi64(a, b);
+#else
+         // both 32-bit halves of a lane have to match
+         SearchVector halves = _mm_cmpeq_epi32(a, b);
+         return _mm_and_si128(halves, _mm_shuffle_epi32(halves,
+                                                        _MM_SHUFFLE(2,3,0,1)));
+#endif
+      }
+};
+
+template <>
+class SearchLanes<float, 4, false> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const float& item) {
+         return _mm_castps_si128(_mm_set1_ps(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a),
+                                              _mm_castsi128_ps(b)));
+      }
+};
+
+template <>
+class SearchLanes<double, 8, false> {
+   public:
+      typedef std::true_type Vectorized;
+      static SearchVector broadcast(const double& item) {
+         return _mm_castpd_si128(_mm_set1_pd(item));
+      }
+      static SearchVector equal(const SearchVector& a, const SearchVector& b) {
+         return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a),
+                                              _mm_castsi128_pd(b)));
+      }
+};
+
+#endif
+
+/*****************************************************************************/
+/********************** Search ***********************************************/
+/*****************************************************************************/
+
+/**
+ * Find the first element equal to item
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: The position of the first element equal to item is
+ *    returned, or -1 if there is none.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+int findItem(const T * items, const int& count, const T& item,
+             std::false_type) {
+   return findItemScalar(items, count, item);
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+template <class T>
+int findItem(const T * items, const int& count, const T& item,
+             std::true_type) {
+   typedef SearchLanes<T> Lanes;
+   const int LANES = SEARCH_VECTOR_BYTES/sizeof(T);
+   
+   SearchVector key = Lanes::broadcast(item);
+   
+   // look at four vectors per test, so the loop is not held up by a branch
+   // on every comparison
+   int i = 0;
+   for (; i+4*LANES<=count; i+=4*LANES) {
+      SearchVector equal0 = Lanes::equal(loadSearchVector(items+i), key);
+      SearchVector equal1 = Lanes::equal(loadSearchVector(items+i+LANES), key);
+      SearchVector equal2 = Lanes::equal(loadSearchVector(items+i+2*LANES),
+                                         key);
+      SearchVector equal3 = Lanes::equal(loadSearchVector(items+i+3*LANES),
+                                         key);
+      
+      SearchVector any = orSearchVectors(orSearchVectors(equal0, equal1),
+                                         orSearchVectors(equal2, equal3));
+      if (searchMask(any) != 0) {
+         break;
+      }
+   }
+   
+   // the match, if any, is in the next four vectors; then the last few
+   // elements that do not fill a vector are compared one at a time
+   for (; i+LANES<=count; i+=LANES) {
+      unsigned int mask = searchMask(Lanes::equal(loadSearchVector(items+i),
+                                                  key));
+      if (mask != 0) {
+         return i+__builtin_ctz(mask)/static_cast<int>(sizeof(T));
+      }
+   }
+   
+   int position = findItemScalar(items+i, count-i, item);
+   
+   return position < 0 ? -1 : i+position;
+}
+
+#endif
+
+template <class T>
+int findItem(const T * items, const int& count, const T& item) {
+   return findItem(items, count, item,
+                   typename SearchLanes<T>::Vectorized());
+}
+
+/**
+ * Count the elements equal to item
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: The number of elements equal to item is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+int countItems(const T * items, const int& count, const T& item,
+               std::false_type) {
+   return countItemsScalar(items, count, item);
+}
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+template <class T>
+int countItems(const T * items, const int& count, const T& item,
+               std::true_type) {
+   typedef SearchLanes<T> Lanes;
+   const int LANES = SEARCH_VECTOR_BYTES/sizeof(T);
+   
+   SearchVector key = Lanes::broadcast(item);
+   
+   // every matching element adds one to each of its sizeof(T) bytes of
+   // counts, which are added up before any of them can pass 255
+   long long matchingBytes = 0;
+   int i = 0;
+   while (i+LANES <= count) {
+      SearchVector counts = zeroSearchVector();
+      for (int run=0; run<255 && i+LANES<=count; ++run, i+=LANES) {
+         counts = addMatchingBytes(counts,
+                                   Lanes::equal(loadSearchVector(items+i),
+                                                key));
+      }
+      matchingBytes += sumMatchingBytes(counts);
+   }
+   
+   return static_cast<int>(matchingBytes/sizeof(T))+
+          countItemsScalar(items+i, count-i, item);
+}
+
+#endif
+
+template <class T>
+int countItems(const T * items, const int& count, const T& item) {
+   return countItems(items, count, item,
+                     typename SearchLanes<T>::Vectorized());
+}
+
+#endif /*ARRAY_SEARCH_H_*/
@@ -0,0 +1,238 @@
+#ifndef ARRAY_SORT_H_
+#define ARRAY_SORT_H_
+
+#include <utility>
+
+// ranges of at most this many elements are left to insertion sort
+const int INSERTION_SORT_CUTOFF = 16;
+
+/*
+ * Introsort for the elements of an array-backed list.
+ * 
+ * sortItems runs quicksort with a median-of-three pivot until the ranges are
+ * at most INSERTION_SORT_CUTOFF elements long, and then a single insertion
+ * sort over the whole array finishes them off. A range that is still being
+ * partitioned after 2 log n levels, as adversarial orders can force, is
+ * heap sorted instead, so the worst case stays O(n log n). The sort is not
+ * stable. Elements are moved with move assignment, so every element must be
+ * constructed. The functions are constexpr so that constexpr lists can sort
+ * at compile time.
+ */
+
+/*****************************************************************************/
+/********************** Helpers **********************************************/
+/*****************************************************************************/
+
+/**
+ * Exchange two elements
+ * 
+ * Precondition: a and b are constructed
+ * Postcondition: a holds the old value of b and b the old value of a.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+constexpr void swapItems(T& a, T& b) {
+   T temp = std::move(a);
+   a = std::move(b);
+   b = std::move(temp);
+}
+
+/**
+ * Sort elements by insertion
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: items[0..count-1] are sorted by compare.
+ * 
+ * Worst-Case Time Complexity: O(n^2); O(n) when every element is at most a
+ *    few places from where it belongs
+ */
+template <class T, class Compare>
+constexpr void insertionSortItems(T * items, const int& count,
+                                  Compare& compare) {
+   for (int i=1; i<count; ++i) {
+      if (!compare(items[i], items[i-1])) {
+         continue;
+      }
+      
+      T item = std::move(items[i]);
+      int j = i;
+      for (; j>0 && compare(item, items[j-1]); --j) {
+         items[j] = std::move(items[j-1]);
+      }
+      items[j] = std::move(item);
+   }
+}
+
+/**
+ * Restore the heap below a node
+ * 
+ * Precondition: The subtrees of root within items[0..count-1] are max-heaps
+ *    by compare
+ * Postcondition: The subtree at root is a max-heap.
+ * 
+ * Worst-Case Time Complexity: O(log n)
+ */
+template <class T, class Compare>
+constexpr void siftDown(T * items, int root, const int& count,
+                        Compare& compare) {
+   T item = std::move(items[root]);
+   
+   for (int child=2*root+1; child<count; child=2*root+1) {
+      if (child+1<count && compare(items[child], items[child+1])) {
+         ++child;
+      }
+      if (!compare(item, items[child])) {
+         break;
+      }
+      
+      items[root] = std::move(items[child]);
+      root = child;
+   }
+   
+   items[root] = std::move(item);
+}
+
+/**
+ * Sort elements with a heap
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: items[0..count-1] are sorted by compare.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Compare>
+constexpr void heapSortItems(T * items, const int& count, Compare& compare) {
+   for (int i=count/2-1; i>=0; --i) {
+      siftDown(items, i, count, compare);
+   }
+   
+   for (int last=count-1; last>0; --last) {
+      swapItems(items[0], items[last]);
+      siftDown(items, 0, last, compare);
+   }
+}
+
+/**
+ * Partition elements around the first one
+ * 
+ * Precondition: count >= 3; items[0] is the pivot, and items[1..count-1]
+ *    hold an element no greater and an element no less than it
+ * Postcondition: For the returned position p, every element of
+ *    items[1..p-1] is no greater than the pivot and every element of
+ *    items[p..count-1] no less.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Compare>
+constexpr int partitionItems(T * items, const int& count, Compare& compare) {
+   int left = 1;
+   int right = count;
+   
+   // the elements either side of the pivot stop the scans, so they need no
+   // bounds checks
+   while (true) {
+      while (compare(items[left], items[0])) {
+         ++left;
+      }
+      --right;
+      while (compare(items[0], items[right])) {
+         --right;
+      }
+      
+      if (left >= right) {
+         return left;
+      }
+      
+      swapItems(items[left], items[right]);
+      ++left;
+   }
+}
+
+/**
+ * Move the median of three elements to the front
+ * 
+ * Precondition: 0, a, b and c are valid positions in items, and a, b and c
+ *    are distinct
+ * Postcondition: items[0] has been exchanged with the median of items[a],
+ *    items[b] and items[c].
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Compare>
+constexpr void moveMedianToFront(T * items, const int& a, const int& b,
+                                 const int& c, Compare& compare) {
+   int median = a;
+   if (compare(items[a], items[b])) {
+      if (compare(items[b], items[c])) {
+         median = b;
+      } else if (compare(items[a], items[c])) {
+         median = c;
+      }
+   } else if (compare(items[a], items[c])) {
+      median = a;
+   } else if (compare(items[b], items[c])) {
+      median = c;
+   } else {
+      median = b;
+   }
+   
+   swapItems(items[0], items[median]);
+}
+
+/**
+ * Quicksort elements down to ranges of INSERTION_SORT_CUTOFF
+ * 
+ * Precondition: items[0..count-1] are constructed; depthLimit >= 0
+ * Postcondition: items[0..count-1] are in runs of at most
+ *    INSERTION_SORT_CUTOFF elements, every run sorted relative to the
+ *    others. Ranges still unsorted after depthLimit partitions have been
+ *    heap sorted.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Compare>
+constexpr void introsortItems(T * items, int count, int depthLimit,
+                              Compare& compare) {
+   while (count > INSERTION_SORT_CUTOFF) {
+      if (depthLimit == 0) {
+         heapSortItems(items, count, compare);
+         return;
+      }
+      --depthLimit;
+      
+      moveMedianToFront(items, 1, count/2, count-1, compare);
+      int cut = partitionItems(items, count, compare);
+      
+      // recurse on the right part and loop on the left one
+      introsortItems(items+cut, count-cut, depthLimit, compare);
+      count = cut;
+   }
+}
+
+/*****************************************************************************/
+/********************** Sorting **********************************************/
+/*****************************************************************************/
+
+/**
+ * Sort elements
+ * 
+ * Precondition: items[0..count-1] are constructed; compare is a strict weak
+ *    ordering
+ * Postcondition: items[0..count-1] are sorted by compare. Equal elements may
+ *    have changed order.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Compare>
+constexpr void sortItems(T * items, const int& count, Compare compare) {
+   int depthLimit = 0;
+   for (int i=count; i>1; i/=2) {
+      depthLimit += 2;
+   }
+   
+   introsortItems(items, count, depthLimit, compare);
+   insertionSortItems(items, count, compare);
+}
+
+#endif /*ARRAY_SORT_H_*/
@@ -0,0 +1,295 @@
+#ifndef ARRAY_STORAGE_H_
+#define ARRAY_STORAGE_H_
+
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// multiplier applied to the capacity of a full array
+const double DEFAULT_GROWTH_FACTOR = 2.0;
+
+// the array is halved once fewer than 1/SHRINK_DIVISOR of its slots are in use
+const int SHRINK_DIVISOR = 4;
+
+/*
+ * Helpers for array-backed lists that keep their elements in raw memory.
+ * 
+ * An array allocated by allocateItems holds no objects. The list constructs
+ * its elements in place in the first size slots and is responsible for
+ * destroying them. Trivially copyable elements are copied and shifted with
+ * memcpy/memmove; everything else is moved one element at a time.
+ */
+
+/*****************************************************************************/
+/********************** Allocation *******************************************/
+/*****************************************************************************/
+
+/**
+ * Allocate raw storage for an array of elements
+ * 
+ * Precondition: capacity >= 0
+ * Postcondition: A pointer to uninitialized memory large enough for capacity
+ *    elements is returned. No T objects have been constructed.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+T * allocateItems(const int& capacity) {
+   T * items = static_cast<T *>(::operator new(capacity*sizeof(T),
+                                               std::nothrow));
+   assert(items != 0 || capacity == 0);
+   
+   return items;
+}
+
+/**
+ * Return storage obtained from allocateItems to the heap
+ * 
+ * Precondition: Every element in items has been destroyed or relocated.
+ *    items may be 0.
+ * Postcondition: The memory has been returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+void deallocateItems(T * items) {
+   ::operator delete(items);
+}
+
+/**
+ * Compute the capacity an array should grow to
+ * 
+ * Precondition: required > capacity; growthFactor > 1
+ * Postcondition: The larger of capacity*growthFactor, capped at INT_MAX,
+ *    and required is returned, and it is always more than capacity.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline int grownCapacity(const int& capacity, const int& required,
+                         const double& growthFactor) {
+   // a product past INT_MAX cannot be converted to int
+   double grown = capacity*growthFactor;
+   int newCapacity = (grown < static_cast<double>(INT_MAX) ?
+                      static_cast<int>(grown) : INT_MAX);
+   if (newCapacity <= capacity) {
+      newCapacity = capacity+1;
+   }
+   if (newCapacity < required) {
+      newCapacity = required;
+   }
+   
+   return newCapacity;
+}
+
+/**
+ * Compute the capacity an array should shrink to after elements are removed
+ * 
+ * Precondition: size <= capacity
+ * Postcondition: capacity, halved for as long as fewer than 1/SHRINK_DIVISOR
+ *    of its slots would be in use and it stays at least minCapacity, is
+ *    returned. Halving only at a quarter full leaves room for the list to
+ *    grow again before the next reallocation, so alternating inserts and
+ *    removes cannot thrash.
+ * 
+ * Worst-Case Time Complexity: O(log capacity)
+ */
+inline int shrunkCapacity(const int& capacity, const int& size,
+                          const int& minCapacity) {
+   int newCapacity = capacity;
+   while (size < newCapacity/SHRINK_DIVISOR && newCapacity/2 >= minCapacity) {
+      newCapacity /= 2;
+   }
+   
+   return newCapacity;
+}
+
+/*****************************************************************************/
+/********************** Construction and Destruction *************************/
+/*****************************************************************************/
+
+/**
+ * Copy-construct count elements from source into raw memory at destination
+ * 
+ * Precondition: destination is uninitialized memory for count elements
+ * Postcondition: destination[0..count-1] are copies of source[0..count-1]
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+void copyItems(const T * source, T * destination, const int& count) {
+   if (std::is_trivially_copyable<T>::value) {
+      if (count > 0) {
+         std::memcpy(static_cast<void *>(destination), source,
+                     count*sizeof(T));
+      }
+      return;
+   }
+   
+   for (int i=0; i<count; ++i) {
+      new (destination+i) T(source[i]);
+   }
+}
+
+/**
+ * Relocate count elements from source into raw memory at destination
+ * 
+ * Precondition: destination is uninitialized memory for count elements and
+ *    does not overlap source
+ * Postcondition: The elements have been moved into destination and the
+ *    originals destroyed, leaving source as raw memory.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+void moveItems(T * source, T * destination, const int& count) {
+   if (std::is_trivially_copyable<T>::value) {
+      if (count > 0) {
+         std::memcpy(static_cast<void *>(destination), source,
+                     count*sizeof(T));
+      }
+      return;
+   }
+   
+   for (int i=0; i<count; ++i) {
+      new (destination+i) T(std::move(source[i]));
+      source[i].~T();
+   }
+}
+
+/**
+ * Relocate count elements to a destination that may overlap them
+ * 
+ * Precondition: source[0..count-1] are constructed; every slot of
+ *    destination[0..count-1] outside the source range is raw memory
+ * Postcondition: The elements have been moved to destination, in order.
+ *    Slots of the source range outside the destination range are left as raw
+ *    memory.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+void relocateItems(T * source, T * destination, const int& count) {
+   if (source == destination) {
+      return;
+   }
+   
+   if (std::is_trivially_copyable<T>::value) {
+      if (count > 0) {
+         std::memmove(static_cast<void *>(destination), source,
+                      count*sizeof(T));
+      }
+      return;
+   }
+   
+   // walk away from the overlap, so each slot written to is already empty
+   if (destination < source) {
+      for (int i=0; i<count; ++i) {
+         new (destination+i) T(std::move(source[i]));
+         source[i].~T();
+      }
+   } else {
+      for (int i=count-1; i>=0; --i) {
+         new (destination+i) T(std::move(source[i]));
+         source[i].~T();
+      }
+   }
+}
+
+/**
+ * Destroy count constructed elements, keeping their storage
+ * 
+ * Precondition: items[0..count-1] are constructed
+ * Postcondition: Each of them has been destroyed, leaving raw memory.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) for trivially destructible T
+ */
+template <class T>
+void destroyItems(T * items, const int& count) {
+   if (std::is_trivially_destructible<T>::value) {
+      return;
+   }
+   
+   for (int i=0; i<count; ++i) {
+      items[i].~T();
+   }
+}
+
+/*****************************************************************************/
+/********************** Shifting *********************************************/
+/*****************************************************************************/
+
+/**
+ * Open a gap of count unconstructed slots at position
+ * 
+ * Precondition: items[0..size-1] are constructed; there is room in the array
+ *    for size+count elements; 0 <= position <= size
+ * Postcondition: The elements at position and beyond have been shifted count
+ *    slots to the right. items[position..position+count-1] is raw memory,
+ *    ready for new elements to be constructed in place.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+void openGap(T * items, const int& size, const int& position,
+             const int& count) {
+   if (position == size || count == 0) {
+      return;
+   }
+   
+   if (std::is_trivially_copyable<T>::value) {
+      std::memmove(static_cast<void *>(items+position+count), items+position,
+                   (size-position)*sizeof(T));
+      return;
+   }
+   
+   // slots past the end are raw memory and must be constructed; the rest
+   // already hold elements and are assigned to
+   for (int i=size-1; i>=position; --i) {
+      if (i+count >= size) {
+         new (items+i+count) T(std::move(items[i]));
+      } else {
+         items[i+count] = std::move(items[i]);
+      }
+   }
+   
+   // leave the gap as raw memory
+   for (int i=position; i<position+count && i<size; ++i) {
+      items[i].~T();
+   }
+}
+
+/**
+ * Remove the elements in [from, to), closing the gap they leave
+ * 
+ * Precondition: items[0..size-1] are constructed; 0 <= from <= to <= size
+ * Postcondition: The elements after to have been shifted left over the
+ *    removed ones. items[0..size-(to-from)-1] are constructed and the slots
+ *    after them are raw memory.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+void closeGap(T * items, const int& size, const int& from, const int& to) {
+   int count = to-from;
+   if (count == 0) {
+      return;
+   }
+   
+   if (std::is_trivially_copyable<T>::value) {
+      std::memmove(static_cast<void *>(items+from), items+to,
+                   (size-to)*sizeof(T));
+      return;
+   }
+   
+   for (int i=to; i<size; ++i) {
+      items[i-count] = std::move(items[i]);
+   }
+   for (int i=size-count; i<size; ++i) {
+      items[i].~T();
+   }
+}
+
+#endif /*ARRAY_STORAGE_H_*/
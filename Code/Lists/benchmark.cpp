@@ -0,0 +1,581 @@
+/*
+ * Benchmark for the List variants.
+ * 
+ * Every variant defines its own List<T>, so this file is compiled once per
+ * variant with the header chosen on the command line:
+ * 
+ *    g++ -O2 -DLIST_HEADER='"dynamicArrayList.h"' benchmark.cpp
+ * 
+ * benchmark.sh does that for every variant and runs the results together.
+ * LIST_NAME labels the output rows and LIST_TYPE selects the instantiation
+ * (e.g. -DLIST_TYPE='List<int, HeapNodeAllocator>').
+ * 
+ * Each workload is run at sizes 10, 100, ..., 10^7 (see --max-size) and
+ * reported as one CSV or JSON row with the mean time, heap allocations and
+ * bytes allocated per operation, and the peak resident set size. Every
+ * workload and size is measured in a child process of its own, so the peak
+ * is that of the one measurement rather than of everything run before it.
+ * 
+ * Built with -DLIST_STATS=ListStats (see listStats.h), the rows also give the
+ * elements copied, moved and shifted and the links followed per operation,
+ * as counted by the list itself. Otherwise those columns are empty (null in
+ * JSON).
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <streambuf>
+#include <type_traits>
+#include <utility>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifndef LIST_HEADER
+#define LIST_HEADER "dynamicArrayList.h"
+#endif
+
+#ifndef LIST_NAME
+#define LIST_NAME LIST_HEADER
+#endif
+
+#include LIST_HEADER
+
+#ifndef LIST_TYPE
+#define LIST_TYPE List<int>
+#endif
+
+typedef LIST_TYPE BenchList;
+
+// the instrumentation policy of the list, and whether it counts anything
+typedef std::decay<decltype(std::declval<BenchList>().getStats())>::type
+   BenchStats;
+const bool COUNTING = BenchStats::ENABLED;
+
+const int MAX_SIZE = 10000000; // largest list size measured by default
+const int DEFAULT_BUDGET_MS = 250; // timed milliseconds per workload and size
+const long long MAX_OPS = 1000000; // stop a measurement after this many ops
+
+/*****************************************************************************/
+/********************** Allocation Counting **********************************/
+/*****************************************************************************/
+
+// every heap allocation in the process goes through these, so a measurement
+// can read the counters before and after its timed operations
+static long long allocationCount = 0;
+static long long allocatedBytes = 0;
+
+// The replacement operators below all go through this one allocator pair.
+// It is kept out of line so the compiler does not see a malloc or free
+// inlined into code that calls new and delete (-Wmismatched-new-delete).
+#ifdef __GNUC__
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#else
+#define BENCHMARK_NOINLINE
+#endif
+
+BENCHMARK_NOINLINE void * allocateCounted(std::size_t size) noexcept {
+   ++allocationCount;
+   allocatedBytes += size;
+   
+   return std::malloc(size == 0 ? 1 : size);
+}
+
+BENCHMARK_NOINLINE void releaseCounted(void * memory) noexcept {
+   std::free(memory);
+}
+
+void * operator new(std::size_t size) {
+   void * memory = allocateCounted(size);
+   if (memory == 0) {
+      throw std::bad_alloc();
+   }
+   
+   return memory;
+}
+
+void * operator new(std::size_t size, const std::nothrow_t&) noexcept {
+   return allocateCounted(size);
+}
+
+void operator delete(void * memory) noexcept {
+   releaseCounted(memory);
+}
+
+void operator delete(void * memory, const std::nothrow_t&) noexcept {
+   ::operator delete(memory);
+}
+
+void operator delete(void * memory, std::size_t) noexcept {
+   ::operator delete(memory);
+}
+
+/*****************************************************************************/
+/********************** Workloads ********************************************/
+/*****************************************************************************/
+
+/**
+ * A stream buffer that discards its output, so display can be timed without
+ * measuring a terminal or a file.
+ */
+class NullBuffer : public std::streambuf {
+   protected:
+      int overflow(int c) { return c; }
+      std::streamsize xsputn(const char *, std::streamsize count) {
+         return count;
+      }
+};
+
+/**
+ * The lists a workload operates on. list starts with size elements; other
+ * is a second list of the same size, for assignment.
+ */
+struct Fixture {
+   BenchList * list;
+   BenchList * other;
+   int size;
+   unsigned int random;
+   int position; // where the last clustered edit happened
+   std::ostream * out;
+};
+
+/**
+ * A workload runs one operation at a time on a freshly filled Fixture. An
+ * operation returns false when the list cannot take it (e.g. a fixed-size
+ * list is full); the fixture is then rebuilt.
+ */
+struct Workload {
+   const char * name;
+   bool needsOther;
+   bool (*operation)(Fixture&, int);
+};
+
+/**
+ * Make the compiler assume memory is read through pointer, so a copy that is
+ * destroyed unread is not optimized away.
+ */
+inline void escape(void * pointer) {
+#ifdef __GNUC__
+   asm volatile("" : : "g"(pointer) : "memory");
+#else
+   static void * volatile sink;
+   sink = pointer;
+#endif
+}
+
+bool insertFront(Fixture& fixture, int i) {
+   return fixture.list->insert(i, 0);
+}
+
+bool insertMiddle(Fixture& fixture, int i) {
+   return fixture.list->insert(i, fixture.list->getSize()/2);
+}
+
+bool insertBack(Fixture& fixture, int i) {
+   return fixture.list->insert(i, fixture.list->getSize());
+}
+
+// xorshift, so that choosing a position costs next to nothing
+unsigned int nextRandom(Fixture& fixture) {
+   fixture.random ^= fixture.random << 13;
+   fixture.random ^= fixture.random >> 17;
+   fixture.random ^= fixture.random << 5;
+   
+   return fixture.random;
+}
+
+bool removeRandom(Fixture& fixture, int) {
+   if (fixture.list->isEmpty()) {
+      return false;
+   }
+   
+   return fixture.list->remove(nextRandom(fixture) % fixture.list->getSize());
+}
+
+// an insert or a remove within a few positions of the previous edit, the
+// way a cursor moves through a text buffer
+bool editClustered(Fixture& fixture, int i) {
+   unsigned int random = nextRandom(fixture);
+   
+   fixture.position += static_cast<int>(random%9)-4;
+   if (fixture.position < 0) {
+      fixture.position = 0;
+   }
+   if (fixture.position >= fixture.list->getSize()) {
+      fixture.position = fixture.list->getSize()-1;
+   }
+   
+   if (random & 0x100) {
+      return fixture.list->insert(i, fixture.position);
+   }
+   return fixture.list->remove(fixture.position);
+}
+
+bool removeFront(Fixture& fixture, int) {
+   return fixture.list->remove(0);
+}
+
+bool removeBack(Fixture& fixture, int) {
+   return fixture.list->remove(fixture.list->getSize()-1);
+}
+
+// the copy is destroyed again, so this measures a copy and its destruction
+bool copyConstruct(Fixture& fixture, int) {
+   BenchList * copy = new BenchList(*fixture.list);
+   escape(copy);
+   delete copy;
+   
+   return true;
+}
+
+bool assign(Fixture& fixture, int) {
+   *fixture.other = *fixture.list;
+   escape(fixture.other);
+   
+   return true;
+}
+
+bool display(Fixture& fixture, int) {
+   *fixture.out << *fixture.list;
+   
+   return true;
+}
+
+const Workload WORKLOADS[] = {
+   { "insert_front", false, insertFront },
+   { "insert_middle", false, insertMiddle },
+   { "insert_back", false, insertBack },
+   { "remove_random", false, removeRandom },
+   { "remove_front", false, removeFront },
+   { "remove_back", false, removeBack },
+   { "edit_clustered", false, editClustered },
+   { "copy_construct", false, copyConstruct },
+   { "assign", true, assign },
+   { "display", false, display }
+};
+
+const int WORKLOAD_COUNT = sizeof(WORKLOADS)/sizeof(WORKLOADS[0]);
+
+/*****************************************************************************/
+/********************** Measurement ******************************************/
+/*****************************************************************************/
+
+struct Measurement {
+   long long ops;
+   double nanoseconds;
+   long long allocations;
+   long long bytes;
+   
+   // as counted by ListStats; zero unless COUNTING
+   long long copies;
+   long long moves;
+   long long shifts;
+   long long links;
+};
+
+using namespace std;
+
+// how a measurement's child process ended
+enum Outcome { MEASURED, SKIPPED, TOO_SLOW, FAILED };
+
+bool fill(BenchList&, const int&);
+bool measure(const Workload&, const int&, const double&, Measurement&);
+Outcome measureInChild(const Workload&, const int&, const double&,
+                       const bool&);
+long peakResidentKilobytes();
+void report(const Workload&, const int&, const Measurement&, const bool&);
+void reportCount(const long long&, const double&, const bool&);
+
+int main(int argc, char * argv[]) {
+   bool json = false;
+   bool header = true;
+   int maxSize = MAX_SIZE;
+   double budget = DEFAULT_BUDGET_MS*1e6;
+   const char * only = 0;
+   
+   for (int i=1; i<argc; ++i) {
+      if (strcmp(argv[i], "--format") == 0 && i+1<argc) {
+         json = strcmp(argv[++i], "json") == 0;
+      } else if (strcmp(argv[i], "--max-size") == 0 && i+1<argc) {
+         maxSize = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--budget-ms") == 0 && i+1<argc) {
+         budget = atoi(argv[++i])*1e6;
+      } else if (strcmp(argv[i], "--workload") == 0 && i+1<argc) {
+         only = argv[++i];
+      } else if (strcmp(argv[i], "--no-header") == 0) {
+         header = false;
+      } else {
+         cerr << "usage: " << argv[0] << " [--format csv|json]"
+              << " [--max-size n] [--budget-ms ms] [--workload name]"
+              << " [--no-header]" << endl;
+         return 1;
+      }
+   }
+   
+   if (header && !json) {
+      cout << "variant,workload,size,ops,ns_per_op,allocations_per_op,"
+           << "bytes_per_op,peak_rss_kb,copies_per_op,moves_per_op,"
+           << "shifts_per_op,links_per_op" << endl;
+   }
+   
+   for (int w=0; w<WORKLOAD_COUNT; ++w) {
+      if (only != 0 && strcmp(only, WORKLOADS[w].name) != 0) {
+         continue;
+      }
+      
+      for (int size=10; size<=maxSize; size*=10) {
+         Outcome outcome = measureInChild(WORKLOADS[w], size, budget, json);
+         if (outcome == SKIPPED) {
+            cerr << LIST_NAME << ": " << WORKLOADS[w].name << " skipped at "
+                 << size << " elements" << endl;
+         } else if (outcome == FAILED) {
+            cerr << LIST_NAME << ": " << WORKLOADS[w].name << " failed at "
+                 << size << " elements" << endl;
+         }
+         
+         // a size that took far too long would make the next one hopeless
+         if (outcome == TOO_SLOW) {
+            break;
+         }
+      }
+   }
+   
+   return 0;
+}
+
+/**
+ * Fill a list with the values 0 through size-1
+ * 
+ * Precondition: list is empty
+ * Postcondition: Returns true if list holds size elements, or false if the
+ *    list refused an insert (it is full).
+ */
+bool fill(BenchList& list, const int& size) {
+   for (int i=0; i<size; ++i) {
+      if (!list.insert(i, i)) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Time a workload on lists of the given size
+ * 
+ * Precondition: budget > 0 (nanoseconds)
+ * Postcondition: The workload's operation has been run on a list filled to
+ *    size, refilling it after at most size operations, until budget
+ *    nanoseconds have been spent in operations or MAX_OPS have run. The
+ *    totals are in measurement. Returns false if a list of this size cannot
+ *    be built.
+ */
+bool measure(const Workload& workload, const int& size, const double& budget,
+             Measurement& measurement) {
+   NullBuffer nullBuffer;
+   ostream nullStream(&nullBuffer);
+   
+   measurement.ops = 0;
+   measurement.nanoseconds = 0;
+   measurement.allocations = 0;
+   measurement.bytes = 0;
+   measurement.copies = 0;
+   measurement.moves = 0;
+   measurement.shifts = 0;
+   measurement.links = 0;
+   
+   Fixture fixture;
+   fixture.size = size;
+   fixture.random = 2463534242u;
+   fixture.position = size/2;
+   fixture.out = &nullStream;
+   
+   while (measurement.nanoseconds < budget && measurement.ops < MAX_OPS) {
+      fixture.list = new BenchList;
+      fixture.other = new BenchList;
+      
+      bool filled = fill(*fixture.list, size) &&
+                    (!workload.needsOther || fill(*fixture.other, size));
+      
+      // run the operations in batches that double in length, so reading the
+      // clock costs little next to fast operations while slow ones still
+      // stop soon after the budget runs out
+      long long done = 0;
+      long long batch = 1;
+      bool full = !filled;
+      while (!full && done < size && measurement.nanoseconds < budget) {
+         if (batch > size-done) {
+            batch = size-done;
+         }
+         
+         long long allocations = allocationCount;
+         long long bytes = allocatedBytes;
+         ListCounters counters = ListStats::getGlobalCounters();
+         chrono::steady_clock::time_point start = chrono::steady_clock::now();
+         
+         long long i = 0;
+         for (; i<batch; ++i) {
+            if (!workload.operation(fixture, static_cast<int>(done+i))) {
+               full = true;
+               break;
+            }
+         }
+         
+         chrono::steady_clock::time_point stop = chrono::steady_clock::now();
+         measurement.nanoseconds +=
+            chrono::duration<double, nano>(stop-start).count();
+         measurement.allocations += allocationCount-allocations;
+         measurement.bytes += allocatedBytes-bytes;
+         
+         ListCounters countersAfter = ListStats::getGlobalCounters();
+         measurement.copies += countersAfter.copies-counters.copies;
+         measurement.moves += countersAfter.moves-counters.moves;
+         measurement.shifts += countersAfter.shifts-counters.shifts;
+         measurement.links += countersAfter.links-counters.links;
+         
+         done += i;
+         batch *= 2;
+      }
+      measurement.ops += done;
+      
+      delete fixture.list;
+      delete fixture.other;
+      
+      if (!filled || done == 0) {
+         return filled && measurement.ops > 0;
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Measure a workload at one size in a child process and report it
+ * 
+ * Precondition: budget > 0 (nanoseconds)
+ * Postcondition: A child process has run measure and, if the list could be
+ *    built, reported the measurement to cout. Returns TOO_SLOW if it was
+ *    reported but took more than budget per operation, SKIPPED if the list
+ *    could not be built, and FAILED if the child could not be started or
+ *    did not exit normally.
+ */
+Outcome measureInChild(const Workload& workload, const int& size,
+                       const double& budget, const bool& json) {
+   // anything still buffered would otherwise be written by both processes
+   cout.flush();
+   cerr.flush();
+   
+   pid_t child = fork();
+   if (child < 0) {
+      return FAILED;
+   }
+   
+   if (child == 0) {
+      Measurement measurement;
+      Outcome outcome = SKIPPED;
+      
+      if (measure(workload, size, budget, measurement)) {
+         report(workload, size, measurement, json);
+         outcome = measurement.nanoseconds/measurement.ops > budget ?
+                   TOO_SLOW : MEASURED;
+      }
+      
+      cout.flush();
+      _exit(outcome);
+   }
+   
+   int status;
+   if (waitpid(child, &status, 0) != child || !WIFEXITED(status)) {
+      return FAILED;
+   }
+   
+   return static_cast<Outcome>(WEXITSTATUS(status));
+}
+
+/**
+ * Get the peak resident set size of this process
+ * 
+ * Precondition: N/A
+ * Postcondition: The largest amount of physical memory the process has used
+ *    so far is returned, in kilobytes.
+ */
+long peakResidentKilobytes() {
+   struct rusage usage;
+   getrusage(RUSAGE_SELF, &usage);
+
+#ifdef __APPLE__
+   return usage.ru_maxrss/1024; // bytes on macOS
+#else
+   return usage.ru_maxrss;
+#endif
+}
+
+/**
+ * Output one measurement as a CSV row or a JSON object on its own line
+ * 
+ * Precondition: measurement.ops > 0
+ * Postcondition: The row has been inserted into cout.
+ */
+void report(const Workload& workload, const int& size,
+            const Measurement& measurement, const bool& json) {
+   double ops = static_cast<double>(measurement.ops);
+   
+   if (json) {
+      cout << "{\"variant\":\"" << LIST_NAME << "\""
+           << ",\"workload\":\"" << workload.name << "\""
+           << ",\"size\":" << size
+           << ",\"ops\":" << measurement.ops
+           << ",\"ns_per_op\":" << measurement.nanoseconds/ops
+           << ",\"allocations_per_op\":" << measurement.allocations/ops
+           << ",\"bytes_per_op\":" << measurement.bytes/ops
+           << ",\"peak_rss_kb\":" << peakResidentKilobytes();
+      
+      cout << ",\"copies_per_op\":";
+      reportCount(measurement.copies, ops, json);
+      cout << ",\"moves_per_op\":";
+      reportCount(measurement.moves, ops, json);
+      cout << ",\"shifts_per_op\":";
+      reportCount(measurement.shifts, ops, json);
+      cout << ",\"links_per_op\":";
+      reportCount(measurement.links, ops, json);
+      
+      cout << "}" << endl;
+   } else {
+      cout << LIST_NAME << "," << workload.name << "," << size
+           << "," << measurement.ops
+           << "," << measurement.nanoseconds/ops
+           << "," << measurement.allocations/ops
+           << "," << measurement.bytes/ops
+           << "," << peakResidentKilobytes();
+      
+      cout << ",";
+      reportCount(measurement.copies, ops, json);
+      cout << ",";
+      reportCount(measurement.moves, ops, json);
+      cout << ",";
+      reportCount(measurement.shifts, ops, json);
+      cout << ",";
+      reportCount(measurement.links, ops, json);
+      
+      cout << endl;
+   }
+}
+
+/**
+ * Output one instrumentation count of a measurement, per operation
+ * 
+ * Precondition: ops > 0
+ * Postcondition: count/ops has been inserted into cout, or nothing (null in
+ *    JSON) if the list does not count.
+ */
+void reportCount(const long long& count, const double& ops, const bool& json) {
+   if (COUNTING) {
+      cout << count/ops;
+   } else if (json) {
+      cout << "null";
+   }
+}
@@ -0,0 +1,32 @@
+#!/bin/sh
+
+# Build benchmark.cpp once for every List variant and run them in turn.
+# Arguments are passed on to each run, e.g.
+#    ./benchmark.sh --format json --max-size 100000 > results.jsonl
+# Extra compiler flags can be given in BENCHMARK_FLAGS; to have the lists
+# count their copies, moves, shifts and links (see listStats.h), run
+#    BENCHMARK_FLAGS=-DLIST_STATS=ListStats ./benchmark.sh
+
+HEADERS="arrayList.h dynamicArrayList.h smallArrayList.h arrayLinkedList.h
+         pointerLinkedList.h pointerLinkedListWithHead.h unrolledLinkedList.h
+         doublyLinkedList.h indexedList.h gapBufferList.h
+         circularArrayList.h"
+
+header=""
+
+for file in $HEADERS
+do
+   name=`basename $file .h`
+
+   if
+      g++ -O2 -Wall -Wextra -DNDEBUG $BENCHMARK_FLAGS \
+          -DLIST_HEADER="\"$file\"" -DLIST_NAME="\"$name\"" \
+          -o benchmark_$name benchmark.cpp
+      then
+         ./benchmark_$name $header "$@"
+         rm benchmark_$name
+   fi
+
+   # only the first run writes the CSV header
+   header="--no-header"
+done
@@ -0,0 +1,293 @@
+/*
+ * Contention benchmark for ConcurrentList.
+ * 
+ *    g++ -O2 -pthread concurrentBenchmark.cpp
+ * 
+ * LIST_HEADER chooses the List variant being wrapped (circularArrayList.h by
+ * default). Three wrappers are compared:
+ * 
+ *    mutexList     the List behind one std::mutex
+ *    rwList        ConcurrentList with a single reader/writer lock
+ *    shardedList   ConcurrentList split into --shards segments
+ * 
+ * For 1, 2, 4, ... up to --max-threads threads, every thread runs a mix of
+ * reads (--read-percent of the operations) and inserts and removes at random
+ * positions, alternating so the list stays near --size elements. A read
+ * displays the first --read-items elements into a stream that discards
+ * them, so it takes the same locks as a reader of the list would; getSize
+ * alone would not, as a sharded list answers it without locking.
+ * Each wrapper and thread count is reported as one CSV or JSON row with the
+ * total operations, the wall-clock time per operation and the operations
+ * per second across all threads.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#ifndef LIST_HEADER
+#define LIST_HEADER "circularArrayList.h"
+#endif
+
+#include LIST_HEADER
+#include "concurrentList.h"
+
+const int MAX_THREADS = 64; // most threads measured by default
+const long long DEFAULT_OPS = 2000000; // operations per thread count
+const int DEFAULT_LIST_SIZE = 10000; // elements in the list while measuring
+const int DEFAULT_READ_PERCENT = 90;
+const int DEFAULT_READ_ITEMS = 16; // elements displayed by a read
+const int DEFAULT_SHARDS = 16;
+
+/*****************************************************************************/
+/********************** Lists ************************************************/
+/*****************************************************************************/
+
+/**
+ * A List behind a single mutex, which readers and writers take alike.
+ */
+class MutexList {
+   public:
+      MutexList(const int&) {}
+      
+      int getSize() const {
+         std::lock_guard<std::mutex> lock(_lock);
+         return _list.getSize();
+      }
+      
+      bool insert(const int& item, const int& position) {
+         std::lock_guard<std::mutex> lock(_lock);
+         return _list.insert(item, position);
+      }
+      
+      bool remove(const int& position) {
+         std::lock_guard<std::mutex> lock(_lock);
+         return _list.remove(position);
+      }
+      
+      void display(std::ostream& out, const int& limit) const {
+         std::lock_guard<std::mutex> lock(_lock);
+         _list.display(out, limit);
+      }
+   private:
+      mutable std::mutex _lock;
+      List<int> _list;
+};
+
+typedef ConcurrentList<int, List<int> > SharedList;
+
+/**
+ * A stream buffer that discards its output, so reads can display the list
+ * without measuring a terminal or a file.
+ */
+class NullBuffer : public std::streambuf {
+   protected:
+      int overflow(int c) { return c; }
+      std::streamsize xsputn(const char *, std::streamsize count) {
+         return count;
+      }
+};
+
+/*****************************************************************************/
+/********************** Measurement ******************************************/
+/*****************************************************************************/
+
+struct Settings {
+   long long ops;
+   int size;
+   int readPercent;
+   int readItems;
+   int shards;
+};
+
+struct Measurement {
+   long long ops;
+   double nanoseconds;
+};
+
+using namespace std;
+
+template <class L>
+bool measure(const int&, const int&, const Settings&, Measurement&);
+template <class L>
+void work(L *, const long long, const Settings *, unsigned int,
+          atomic<bool> *, long long *);
+void report(const char *, const int&, const Measurement&, const bool&);
+
+int main(int argc, char * argv[]) {
+   bool json = false;
+   bool header = true;
+   int maxThreads = MAX_THREADS;
+   
+   Settings settings;
+   settings.ops = DEFAULT_OPS;
+   settings.size = DEFAULT_LIST_SIZE;
+   settings.readPercent = DEFAULT_READ_PERCENT;
+   settings.readItems = DEFAULT_READ_ITEMS;
+   settings.shards = DEFAULT_SHARDS;
+   
+   for (int i=1; i<argc; ++i) {
+      if (strcmp(argv[i], "--format") == 0 && i+1<argc) {
+         json = strcmp(argv[++i], "json") == 0;
+      } else if (strcmp(argv[i], "--max-threads") == 0 && i+1<argc) {
+         maxThreads = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--ops") == 0 && i+1<argc) {
+         settings.ops = atoll(argv[++i]);
+      } else if (strcmp(argv[i], "--size") == 0 && i+1<argc) {
+         settings.size = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--read-percent") == 0 && i+1<argc) {
+         settings.readPercent = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--read-items") == 0 && i+1<argc) {
+         settings.readItems = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--shards") == 0 && i+1<argc) {
+         settings.shards = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--no-header") == 0) {
+         header = false;
+      } else {
+         cerr << "usage: " << argv[0] << " [--format csv|json]"
+              << " [--max-threads n] [--ops n] [--size n]"
+              << " [--read-percent p] [--read-items n] [--shards n]"
+              << " [--no-header]" << endl;
+         return 1;
+      }
+   }
+   
+   if (header && !json) {
+      cout << "variant,threads,ops,ns_per_op,ops_per_second" << endl;
+   }
+   
+   for (int threads=1; threads<=maxThreads; threads*=2) {
+      Measurement measurement;
+      
+      if (measure<MutexList>(threads, 1, settings, measurement)) {
+         report("mutexList", threads, measurement, json);
+      }
+      if (measure<SharedList>(threads, 1, settings, measurement)) {
+         report("rwList", threads, measurement, json);
+      }
+      if (measure<SharedList>(threads, settings.shards, settings,
+                              measurement)) {
+         report("shardedList", threads, measurement, json);
+      }
+   }
+   
+   return 0;
+}
+
+/**
+ * Time threads threads sharing one list
+ * 
+ * Precondition: threads > 0; settings.ops > 0
+ * Postcondition: threads threads have run about settings.ops operations
+ *    between them on a list of type L (constructed with shards) holding
+ *    settings.size elements, all released at once. The operations run and
+ *    the wall-clock time from release to the last thread finishing are in
+ *    measurement. Returns false if the list could not be filled.
+ */
+template <class L>
+bool measure(const int& threads, const int& shards, const Settings& settings,
+             Measurement& measurement) {
+   L list(shards);
+   for (int i=0; i<settings.size; ++i) {
+      if (!list.insert(i, i)) {
+         return false;
+      }
+   }
+   
+   atomic<bool> start(false);
+   vector<long long> done(threads, 0);
+   vector<thread> workers;
+   
+   long long ops = settings.ops/threads;
+   for (int i=0; i<threads; ++i) {
+      workers.push_back(thread(work<L>, &list, ops, &settings,
+                               2463534242u+i, &start, &done[i]));
+   }
+   
+   chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+   start.store(true);
+   for (int i=0; i<threads; ++i) {
+      workers[i].join();
+   }
+   chrono::steady_clock::time_point end = chrono::steady_clock::now();
+   
+   measurement.ops = 0;
+   for (int i=0; i<threads; ++i) {
+      measurement.ops += done[i];
+   }
+   measurement.nanoseconds = chrono::duration<double, nano>(end-begin).count();
+   
+   return measurement.ops > 0;
+}
+
+/**
+ * The body of one benchmark thread
+ * 
+ * Precondition: list is shared by every thread of the measurement; random
+ *    is a nonzero seed
+ * Postcondition: Once start was set, ops operations have been run: with
+ *    probability settings->readPercent a display of the first
+ *    settings->readItems elements, otherwise an insert or a remove at a
+ *    random position, in turn. The count is in *done.
+ */
+template <class L>
+void work(L * list, const long long ops, const Settings * settings,
+          unsigned int random, atomic<bool> * start, long long * done) {
+   NullBuffer nullBuffer;
+   ostream nullStream(&nullBuffer);
+   
+   while (!start->load()) {
+      this_thread::yield();
+   }
+   
+   bool insertNext = true;
+   for (long long i=0; i<ops; ++i) {
+      // xorshift, so that choosing an operation costs next to nothing
+      random ^= random << 13;
+      random ^= random >> 17;
+      random ^= random << 5;
+      
+      int position = static_cast<int>((random >> 8) % settings->size);
+      if (static_cast<int>(random % 100) < settings->readPercent) {
+         list->display(nullStream, settings->readItems);
+      } else if (insertNext) {
+         list->insert(static_cast<int>(i), position);
+         insertNext = false;
+      } else {
+         list->remove(position);
+         insertNext = true;
+      }
+   }
+   
+   *done = ops;
+}
+
+/**
+ * Output one measurement as a CSV row or a JSON object on its own line
+ * 
+ * Precondition: measurement.ops > 0
+ * Postcondition: The row has been inserted into cout.
+ */
+void report(const char * variant, const int& threads,
+            const Measurement& measurement, const bool& json) {
+   double ops = static_cast<double>(measurement.ops);
+   double nanosecondsPerOp = measurement.nanoseconds/ops;
+   
+   if (json) {
+      cout << "{\"variant\":\"" << variant << "\""
+           << ",\"threads\":" << threads
+           << ",\"ops\":" << measurement.ops
+           << ",\"ns_per_op\":" << nanosecondsPerOp
+           << ",\"ops_per_second\":" << 1e9/nanosecondsPerOp << "}" << endl;
+   } else {
+      cout << variant << "," << threads << "," << measurement.ops
+           << "," << nanosecondsPerOp
+           << "," << 1e9/nanosecondsPerOp << endl;
+   }
+}
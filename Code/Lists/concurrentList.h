@@ -0,0 +1,640 @@
+#ifndef CONCURRENT_LIST_H_
+#define CONCURRENT_LIST_H_
+
+#include <atomic>
+#include <iostream>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "listWriter.h"
+
+const int SHARD_ALIGNMENT = 64; // a cache line, so shards never share one
+
+// a segment is spread over its neighbours once it holds more than twice the
+// average, but one smaller than this is never worth the trouble
+const int MIN_SPLIT_SIZE = 64;
+
+template <typename T, class Backend> class ConcurrentList;
+template <typename T, class Backend>
+std::ostream& operator<<(std::ostream&, const ConcurrentList<T, Backend>&);
+
+/**
+ * A thread-safe wrapper around any of the List variants, for read-mostly
+ * workloads. Backend is the wrapped list type, e.g.
+ * 
+ *    #include "dynamicArrayList.h"
+ *    #include "concurrentList.h"
+ * 
+ *    ConcurrentList<int, List<int> > list;
+ * 
+ * By default the list is one Backend behind a reader/writer lock: getSize,
+ * isEmpty and display take it shared, so any number of them run at once,
+ * and insert and remove take it exclusively.
+ * 
+ * With more than one shard the list is split into segments, each a Backend
+ * with its own lock, one after another in position order. A writer locks
+ * only the segment it changes, exclusively, and holds shared locks on the
+ * segments before it so that positions cannot shift under it; writers in
+ * different segments therefore run in parallel. Locks are always taken in
+ * segment order, so threads cannot deadlock. An insert at the boundary
+ * between two segments goes into the smaller one.
+ * 
+ * That alone does not spread the list: appends always reach the last
+ * segment. So after an insert leaves a segment with more than twice the
+ * average number of elements (and more than MIN_SPLIT_SIZE), its excess is
+ * moved to the neighbour that is the smaller of its two, under exclusive
+ * locks on both, and onward from that neighbour in the same direction while
+ * it is then oversized in turn. Elements keep their positions in the list;
+ * only the boundaries between segments move. Each element moved costs a
+ * copy, which appends pay for at a few copies each over time.
+ * 
+ * display locks the segments it shows, in
+ * order, and sees a consistent snapshot of them; with a limit it stops at
+ * the segment holding the last element shown. getSize and isEmpty read a
+ * count that writers update under their segment's lock, so they take no
+ * lock at all.
+ * 
+ * Every writer finds its segment by walking from the first one, so every
+ * writer takes the first segment's lock, if only shared. Taking a shared
+ * lock still writes the lock's word, so that one cache line is written by
+ * all writers, whichever segment they change: sharding spreads the
+ * exclusive locks and the Backend work, but not that contention, which
+ * grows with the number of cores writing.
+ */
+template <class T, class Backend>
+class ConcurrentList {
+   private:
+      class alignas(SHARD_ALIGNMENT) Shard {
+         public:
+            mutable std::shared_mutex lock;
+            Backend list;
+            
+            // list.getSize(), set under the lock, so that rebalancing can
+            // choose a neighbour without locking it
+            std::atomic<int> size;
+      };
+      
+      // collects the elements of a Backend in [first, first+count)
+      class Collector {
+         public:
+            Collector(const int& first, const int& count);
+            
+            bool add(const T&);
+            
+            std::vector<T> items;
+         private:
+            int _skip; // elements still to pass over before collecting
+            int _count;
+      };
+   public:
+      ConcurrentList(const int& shards=1);
+      
+      ~ConcurrentList();
+      
+      int getSize() const;
+      int getShardCount() const;
+      int getShardSize(const int&) const;
+      
+      bool isEmpty() const;
+      bool insert(const T&, const int&);
+      bool insert(T&&, const int&);
+      bool remove(const int&);
+      
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&,
+                                         const ConcurrentList<T, Backend>&);
+   private:
+      Shard * _shards; // array of _shardCount segments, in position order
+      int _shardCount;
+      
+      // elements in all the segments, kept only with more than one; on its
+      // own cache line since every writer changes it
+      alignas(SHARD_ALIGNMENT) std::atomic<int> _size;
+      
+      template <class Item>
+      bool insertItem(Item&&, const int&);
+      
+      int splitSize() const;
+      void rebalance(const int&);
+      bool moveItems(const int&, const int&, const int&);
+      
+      void unlockShared(const int&) const;
+      
+      ConcurrentList(const ConcurrentList&);
+      const ConcurrentList& operator=(const ConcurrentList&);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct an empty concurrent list
+ * 
+ * Precondition: shards is the number of independently locked segments, with
+ *    default value of 1 (a single reader/writer lock around one Backend)
+ * Postcondition: An empty list with max(shards, 1) segments, each an empty
+ *    Backend.
+ * 
+ * Worst-Case Time Complexity: O(shards)
+ */
+template <class T, class Backend>
+ConcurrentList<T, Backend>::ConcurrentList(const int& shards) {
+   _shardCount = (shards>1 ? shards : 1);
+   _shards = new Shard[_shardCount];
+   for (int i=0; i<_shardCount; ++i) {
+      _shards[i].size.store(0);
+   }
+   _size.store(0);
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a concurrent list object
+ * 
+ * Precondition: The life of the object is over; no other thread is using
+ *    the list.
+ * Postcondition: Every segment has been destroyed.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Backend>
+ConcurrentList<T, Backend>::~ConcurrentList() {
+   delete [] _shards;
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a concurrent list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list at one moment
+ *    during the call is returned.
+ * 
+ * Worst-Case Time Complexity: O(1) plus, with a single segment, waiting for
+ *    writers
+ */
+template <class T, class Backend>
+int ConcurrentList<T, Backend>::getSize() const {
+   if (_shardCount > 1) {
+      return _size.load();
+   }
+   
+   std::shared_lock<std::shared_mutex> lock(_shards[0].lock);
+   
+   return _shards[0].list.getSize();
+}
+
+/**
+ * Get the number of segments of a concurrent list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of independently locked segments is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Backend>
+int ConcurrentList<T, Backend>::getShardCount() const {
+   return _shardCount;
+}
+
+/**
+ * Get the size of one segment of a concurrent list object
+ * 
+ * Precondition: 0 <= shard < the number of segments
+ * Postcondition: The number of elements the segment held at one moment
+ *    during the call is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Backend>
+int ConcurrentList<T, Backend>::getShardSize(const int& shard) const {
+   return _shards[shard].size.load();
+}
+
+/**
+ * Check if a concurrent list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if the list was empty at one moment during the
+ *    call and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(1) plus, with a single segment, waiting for
+ *    writers
+ */
+template <class T, class Backend>
+bool ConcurrentList<T, Backend>::isEmpty() const {
+   if (_shardCount > 1) {
+      return _size.load() == 0;
+   }
+   
+   std::shared_lock<std::shared_mutex> lock(_shards[0].lock);
+   
+   return _shards[0].list.isEmpty();
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Insert an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item is inserted into the list at the specified position,
+ *    as a single atomic step. Returns false if the position is out of range
+ *    or the segment's Backend refused the insert (e.g. it is full).
+ * 
+ * Worst-case Time Complexity: O(shards) plus the Backend's insert into one
+ *    segment, plus waiting for other writers to that segment
+ */
+template <class T, class Backend>
+bool ConcurrentList<T, Backend>::insert(const T& item, const int& position) {
+   return insertItem(item, position);
+}
+
+/**
+ * Move an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item has been moved into the list at the specified
+ *    position, as for insert(const T&, position).
+ * 
+ * Worst-case Time Complexity: O(shards) plus the Backend's insert into one
+ *    segment, plus waiting for other writers to that segment
+ */
+template <class T, class Backend>
+bool ConcurrentList<T, Backend>::insert(T&& item, const int& position) {
+   return insertItem(std::move(item), position);
+}
+
+/**
+ * Remove the item at the specified position
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: element at the specified position has been removed, as a
+ *    single atomic step. Returns false if the position is out of range.
+ * 
+ * Worst-Case Time Complexity: O(shards) plus the Backend's remove from one
+ *    segment, plus waiting for other writers to that segment
+ */
+template <class T, class Backend>
+bool ConcurrentList<T, Backend>::remove(const int& position) {
+   if (position<0) {
+      return false;
+   }
+   
+   // shards before k stay locked shared while offset counts their elements
+   int offset = 0;
+   int k = 0;
+   _shards[0].lock.lock_shared();
+   
+   while (true) {
+      int size = _shards[k].list.getSize();
+      
+      if (position >= offset+size) {
+         if (k+1 == _shardCount) {
+            unlockShared(k+1);
+            return false;
+         }
+         
+         _shards[k+1].lock.lock_shared();
+         offset += size;
+         ++k;
+         continue;
+      }
+      
+      // trade the shared lock for an exclusive one, then make sure the
+      // segment still holds the position
+      _shards[k].lock.unlock_shared();
+      _shards[k].lock.lock();
+      
+      if (position >= offset+_shards[k].list.getSize()) {
+         _shards[k].lock.unlock();
+         _shards[k].lock.lock_shared();
+         continue;
+      }
+      
+      bool removed = _shards[k].list.remove(position-offset);
+      if (removed && _shardCount > 1) {
+         _shards[k].size.store(_shards[k].list.getSize());
+         _size.fetch_sub(1);
+      }
+      
+      _shards[k].lock.unlock();
+      unlockShared(k);
+      
+      return removed;
+   }
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list, as it was at one moment during the call, has been
+ *    inserted into out in the Backend's format, as if it were one Backend.
+ *    Given a limit, only the first limit elements are shown, followed by
+ *    "..." if there are more.
+ * 
+ * Worst-Case Time Complexity: O(n) plus waiting for writers; with a limit,
+ *    O(shards + limit) plus waiting for writers to the segments shown
+ */
+template <class T, class Backend>
+void ConcurrentList<T, Backend>::display(std::ostream& out,
+                                         const int& limit) const {
+   // every segment is written through the one writer, so nothing is
+   // allocated and the limit and separators carry across segments
+   ListWriter writer(out, limit, Backend::DISPLAY_TERMINATED);
+   
+   // segments before locked are locked shared; once the writer stops taking
+   // elements, the segments after it need not be locked at all
+   int locked = 0;
+   bool complete = true;
+   while (complete && locked < _shardCount) {
+      _shards[locked].lock.lock_shared();
+      complete = _shards[locked].list.addItemsTo(writer);
+      ++locked;
+   }
+   
+   unlockShared(locked);
+   writer.finish();
+}
+
+/**
+ * Output operator for a concurrent list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted
+ *    into out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T, class Backend>
+std::ostream& operator<<(std::ostream& out,
+                         const ConcurrentList<T, Backend>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Insert or move an item into the list at the specified position
+ * 
+ * Precondition: item is a const T& or a T&&
+ * Postcondition: As for insert. The segment is the one holding position,
+ *    or at the boundary between two segments the smaller of them. If that
+ *    leaves the segment oversized, it has then been rebalanced.
+ * 
+ * Worst-Case Time Complexity: O(shards) plus the Backend's insert, plus
+ *    O(n) element moves when a segment is rebalanced
+ */
+template <class T, class Backend>
+template <class Item>
+bool ConcurrentList<T, Backend>::insertItem(Item&& item,
+                                            const int& position) {
+   if (position<0) {
+      return false;
+   }
+   
+   // shards before k stay locked shared while offset counts their elements
+   int offset = 0;
+   int k = 0;
+   _shards[0].lock.lock_shared();
+   
+   while (true) {
+      int size = _shards[k].list.getSize();
+      
+      if (position > offset+size) {
+         if (k+1 == _shardCount) {
+            unlockShared(k+1);
+            return false;
+         }
+         
+         _shards[k+1].lock.lock_shared();
+         offset += size;
+         ++k;
+         continue;
+      }
+      
+      // at the end of a segment, the start of the next one is the same
+      // position; prefer whichever segment is smaller
+      if (position == offset+size && k+1 < _shardCount) {
+         _shards[k+1].lock.lock_shared();
+         if (_shards[k+1].list.getSize() < size) {
+            offset += size;
+            ++k;
+            continue;
+         }
+         _shards[k+1].lock.unlock_shared();
+      }
+      
+      // trade the shared lock for an exclusive one, then make sure the
+      // segment still reaches the position
+      _shards[k].lock.unlock_shared();
+      _shards[k].lock.lock();
+      
+      if (position > offset+_shards[k].list.getSize()) {
+         _shards[k].lock.unlock();
+         _shards[k].lock.lock_shared();
+         continue;
+      }
+      
+      bool inserted = _shards[k].list.insert(std::forward<Item>(item),
+                                             position-offset);
+      bool oversized = false;
+      if (inserted && _shardCount > 1) {
+         _shards[k].size.store(_shards[k].list.getSize());
+         _size.fetch_add(1);
+         oversized = _shards[k].list.getSize() > splitSize();
+      }
+      
+      _shards[k].lock.unlock();
+      unlockShared(k);
+      
+      if (oversized) {
+         rebalance(k);
+      }
+      
+      return inserted;
+   }
+}
+
+/**
+ * Get the size above which a segment is rebalanced
+ * 
+ * Precondition: N/A
+ * Postcondition: Twice the average number of elements per segment, or
+ *    MIN_SPLIT_SIZE if that is more, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Backend>
+int ConcurrentList<T, Backend>::splitSize() const {
+   int size = 2*(_size.load()/_shardCount);
+   
+   return (size > MIN_SPLIT_SIZE ? size : MIN_SPLIT_SIZE);
+}
+
+/**
+ * Spread an oversized segment over the segments beside it
+ * 
+ * Precondition: The calling thread holds no lock on the list;
+ *    0 <= k < the number of segments
+ * Postcondition: If segment k held more than splitSize() elements, all but
+ *    the average number have been moved to the neighbour that was the
+ *    smaller of its two; then, for as long as the segment that received them
+ *    was oversized in turn, the same was done from it onward in the same
+ *    direction. Every element keeps its position in the list.
+ * 
+ * Worst-Case Time Complexity: O(n) element moves, plus waiting for the
+ *    segments' locks
+ */
+template <class T, class Backend>
+void ConcurrentList<T, Backend>::rebalance(const int& k) {
+   int direction = 1;
+   if (k == _shardCount-1 ||
+       (k > 0 && _shards[k-1].size.load() < _shards[k+1].size.load())) {
+      direction = -1;
+   }
+   
+   for (int from=k; from+direction>=0 && from+direction<_shardCount;
+        from+=direction) {
+      int to = from+direction;
+      
+      // both exclusively, in segment order as every lock is taken; the
+      // segments before them keep their sizes, so need no lock
+      Shard& low = _shards[from<to ? from : to];
+      Shard& high = _shards[from<to ? to : from];
+      low.lock.lock();
+      high.lock.lock();
+      
+      int size = _shards[from].list.getSize();
+      bool oversized = size > splitSize();
+      if (oversized) {
+         oversized = moveItems(from, to, size-_size.load()/_shardCount);
+      }
+      
+      high.lock.unlock();
+      low.lock.unlock();
+      
+      if (!oversized) {
+         return;
+      }
+   }
+}
+
+/**
+ * Move elements from one segment to the one beside it, across the boundary
+ * between them
+ * 
+ * Precondition: The calling thread holds exclusive locks on segments from
+ *    and to; to is from-1 or from+1; 0 < count <= the size of segment from
+ * Postcondition: The count elements of segment from nearest to segment to
+ *    have been moved into it, so every element keeps its position in the
+ *    list, and true is returned. If segment to refused them (e.g. it is
+ *    full), false is returned and neither segment has changed.
+ * 
+ * Worst-Case Time Complexity: O(count) plus the Backends' insertRange and
+ *    removeRange
+ */
+template <class T, class Backend>
+bool ConcurrentList<T, Backend>::moveItems(const int& from, const int& to,
+                                           const int& count) {
+   Backend& source = _shards[from].list;
+   Backend& destination = _shards[to].list;
+   
+   // the tail of from goes to the front of to, or the front of from to the
+   // tail of to
+   int first = (to > from ? source.getSize()-count : 0);
+   int position = (to > from ? 0 : destination.getSize());
+   
+   Collector collector(first, count);
+   source.addItemsTo(collector);
+   
+   if (!destination.insertRange(collector.items.begin(),
+                                collector.items.end(), position)) {
+      return false;
+   }
+   source.removeRange(first, first+count);
+   
+   _shards[from].size.store(source.getSize());
+   _shards[to].size.store(destination.getSize());
+   
+   return true;
+}
+
+/**
+ * Release the shared locks on the first count segments
+ * 
+ * Precondition: The calling thread holds shared locks on segments 0 through
+ *    count-1
+ * Postcondition: Those locks have been released.
+ * 
+ * Worst-Case Time Complexity: O(count)
+ */
+template <class T, class Backend>
+void ConcurrentList<T, Backend>::unlockShared(const int& count) const {
+   for (int i=count-1; i>=0; --i) {
+      _shards[i].lock.unlock_shared();
+   }
+}
+
+/*****************************************************************************/
+/********************** Collector ********************************************/
+/*****************************************************************************/
+
+/**
+ * Construct a collector for the elements in [first, first+count)
+ * 
+ * Precondition: first >= 0; count > 0
+ * Postcondition: An empty collector, with room for count elements.
+ * 
+ * Worst-Case Time Complexity: O(count)
+ */
+template <class T, class Backend>
+ConcurrentList<T, Backend>::Collector::Collector(const int& first,
+                                                 const int& count) {
+   _skip = first;
+   _count = count;
+   items.reserve(count);
+}
+
+/**
+ * Take the next element of a Backend, as its addItemsTo gives them
+ * 
+ * Precondition: N/A
+ * Postcondition: item has been copied into items if it is in the range.
+ *    Return false once the whole range has been collected, and true
+ *    otherwise.
+ * 
+ * Worst-Case Time Complexity: O(1) amortized
+ */
+template <class T, class Backend>
+bool ConcurrentList<T, Backend>::Collector::add(const T& item) {
+   if (_skip > 0) {
+      --_skip;
+      return true;
+   }
+   
+   items.push_back(item);
+   
+   return static_cast<int>(items.size()) < _count;
+}
+
+#endif /*CONCURRENT_LIST_H_*/
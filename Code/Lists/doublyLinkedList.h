@@ -0,0 +1,878 @@
+#ifndef DOUBLY_LINKED_LIST_H_
+#define DOUBLY_LINKED_LIST_H_
+
+#include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+
+#include "listStats.h"
+#include "listWriter.h"
+#include "nodePool.h"
+
+template <typename T, template <class> class Allocator = NodePool,
+          class Stats = LIST_STATS> class List;
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Allocator, Stats>&);
+
+/**
+ * A doubly linked list with pointers to both its first and last nodes.
+ * Inserting or removing at either end is O(1), and a walk to a position
+ * starts from whichever of the two ends, or the remembered cursor, is
+ * closest, so it never takes more than n/2 steps.
+ */
+template <class T, template <class> class Allocator, class Stats>
+class List : private Stats {
+   private:
+      class Node {
+         public:
+            T data;
+            Node * prev;
+            Node * next;
+      };
+   public:
+      // bidirectional iterators over the elements of the list. An iterator
+      // stays valid until the node it refers to is removed.
+      class iterator {
+         public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T * pointer;
+            typedef T & reference;
+            
+            iterator() { _node = 0; _list = 0; }
+            
+            reference operator*() const { return _node->data; }
+            pointer operator->() const { return &_node->data; }
+            
+            iterator& operator++() {
+               _node = _node->next;
+               return *this;
+            }
+            iterator operator++(int) {
+               iterator old = *this;
+               _node = _node->next;
+               return old;
+            }
+            iterator& operator--() {
+               _node = (_node == 0 ? _list->_last : _node->prev);
+               return *this;
+            }
+            iterator operator--(int) {
+               iterator old = *this;
+               --*this;
+               return old;
+            }
+            
+            bool operator==(const iterator& rhs) const {
+               return _node == rhs._node;
+            }
+            bool operator!=(const iterator& rhs) const {
+               return _node != rhs._node;
+            }
+         private:
+            friend class List;
+            iterator(Node * node, const List * list) {
+               _node = node;
+               _list = list;
+            }
+            Node * _node;
+            const List * _list; // to step back from end()
+      };
+      
+      class const_iterator {
+         public:
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T * pointer;
+            typedef const T & reference;
+            
+            const_iterator() { _node = 0; _list = 0; }
+            const_iterator(const iterator& it) {
+               _node = it._node;
+               _list = it._list;
+            }
+            
+            reference operator*() const { return _node->data; }
+            pointer operator->() const { return &_node->data; }
+            
+            const_iterator& operator++() {
+               _node = _node->next;
+               return *this;
+            }
+            const_iterator operator++(int) {
+               const_iterator old = *this;
+               _node = _node->next;
+               return old;
+            }
+            const_iterator& operator--() {
+               _node = (_node == 0 ? _list->_last : _node->prev);
+               return *this;
+            }
+            const_iterator operator--(int) {
+               const_iterator old = *this;
+               --*this;
+               return old;
+            }
+            
+            bool operator==(const const_iterator& rhs) const {
+               return _node == rhs._node;
+            }
+            bool operator!=(const const_iterator& rhs) const {
+               return _node != rhs._node;
+            }
+         private:
+            friend class List;
+            const_iterator(const Node * node, const List * list) {
+               _node = node;
+               _list = list;
+            }
+            const Node * _node;
+            const List * _list;
+      };
+      
+      List();
+      List(const List&);
+      
+      ~List();
+      
+      int getSize() const;
+      int getCapacity() const;
+      const Stats& getStats() const;
+      
+      bool isEmpty() const;
+      bool insert(const T&, const int&);
+      bool remove(const int&);
+      
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      
+      iterator insertBefore(iterator, const T&);
+      iterator erase(iterator);
+      
+      const List& operator=(const List&);
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = true;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
+   private:
+      Node * _first; // pointer to the first element of the linked list
+      Node * _last; // pointer to the last element of the linked list
+      int _size; // the number of elements stored in the linked list
+      
+      // the node most recently reached by a positional walk, and its
+      // position. A walk starts from here when it is closer to the target
+      // than either end. _cursor is 0 when no position is remembered.
+      mutable Node * _cursor;
+      mutable int _cursorPosition;
+      
+      Node * findNode(const int&) const;
+      void linkBefore(Node *, Node *);
+      void unlink(Node *);
+      
+      // the nodes of this list are allocated from, and returned to, _pool
+      Allocator<Node> _pool;
+      
+      Node * createNode();
+      void destroyNode(Node *);
+      
+      bool copyList(const Node *);
+      bool deleteList(Node *);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty list, with size 0, is created.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List() {
+   _first = 0;
+   _last = 0;
+   _size = 0;
+   _cursor = 0;
+   _cursorPosition = 0;
+}
+
+/**
+ * Construct a copy of a List object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A copy of originalList has been constructed.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List(const List& originalList) {
+   // initialize an empty list
+   _first = 0;
+   _last = 0;
+   _size = 0;
+   _cursor = 0;
+   _cursorPosition = 0;
+   
+   // copy the original list
+   copyList(originalList._first);
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The memory dynamically allocated by the linked list has been
+ *    returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::~List() {
+   deleteList(_first);
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getSize() const {
+   return _size;
+}
+
+/**
+ * Get the capacity of a list object.
+ * 
+ * Note that this function is only provided for compatability with other list
+ * implementations.
+ * 
+ * Precondition: N/A
+ * Postcondition: -1 is returned since a pointer based linked list has no
+ *    predefined capacity
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getCapacity() const {
+   return -1;
+}
+
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+const Stats& List<T, Allocator, Stats>::getStats() const {
+   return *this;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::isEmpty() const {
+   return _size==0;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Insert an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item is inserted into the list at the specified position.
+ * 
+ * Worst-case Time Complexity: O(min(position, size-position)); O(1) at
+ *    either end
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::insert(const T& item, const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   // create a new node with the specified data
+   Node * newNode = createNode();
+   newNode->data = item;
+   this->countCopies(1);
+   
+   // link it in before the node now at position (none when appending)
+   Node * successor = (position == _size ? 0 : findNode(position));
+   
+   // every remembered node from position on moves one position down
+   if (_cursor != 0 && _cursorPosition >= position) {
+      ++_cursorPosition;
+   }
+   
+   linkBefore(newNode, successor);
+   
+   return true;
+}
+
+/**
+ * Remove the item at the specified position
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: element at the specified position has been removed.
+ * 
+ * Worst-Case Time Complexity: O(min(position, size-position)); O(1) at
+ *    either end
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::remove(const int& position) {
+   // verify we can delete an element
+   if (_size==0) {
+      return false;
+   }
+   
+   // verify this is a valid item to delete
+   if (position<0 || position>=_size) {
+      return false;
+   }
+   
+   Node * ptr = findNode(position);
+   
+   // remember a neighbour instead of the removed node
+   if (ptr->next != 0) {
+      _cursor = ptr->next;
+   } else {
+      _cursor = ptr->prev;
+      --_cursorPosition;
+   }
+   
+   unlink(ptr);
+   destroyNode(ptr);
+   
+   return true;
+}
+
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are input iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The list is walked to position only once.
+ * 
+ * Worst-case Time Complexity: O(min(position, size-position) + k), k being
+ *    the number of items inserted
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Iterator>
+bool List<T, Allocator, Stats>::insertRange(Iterator first, Iterator last,
+                                            const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   Node * successor = (position == _size ? 0 : findNode(position));
+   
+   int count = 0;
+   for (; first!=last; ++first) {
+      Node * newNode = createNode();
+      newNode->data = *first;
+      this->countCopies(1);
+      linkBefore(newNode, successor);
+      ++count;
+   }
+   
+   if (_cursor != 0 && _cursorPosition >= position) {
+      _cursorPosition += count;
+   }
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. The list is
+ *    walked to from only once.
+ * 
+ * Worst-Case Time Complexity: O(min(from, size-from) + (to-from))
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   if (from == to) {
+      return true;
+   }
+   
+   Node * ptr = findNode(from);
+   _cursor = 0;
+   
+   for (int i=from; i<to; ++i) {
+      Node * tempPtr = ptr;
+      ptr = ptr->next;
+      unlink(tempPtr);
+      destroyNode(tempPtr);
+   }
+   this->countLinks(to-from);
+   
+   return true;
+}
+
+/**
+ * Get an iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator referring to the first element is returned, or
+ *    end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::begin() {
+   return iterator(_first, this);
+}
+
+/**
+ * Get an iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator that compares equal to an iterator advanced past
+ *    the last element is returned. Decrementing it gives the last element.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::end() {
+   return iterator(0, this);
+}
+
+/**
+ * Get a const iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator referring to the first element is returned,
+ *    or end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::const_iterator
+List<T, Allocator, Stats>::begin() const {
+   return const_iterator(_first, this);
+}
+
+/**
+ * Get a const iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator that compares equal to a const_iterator
+ *    advanced past the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::const_iterator
+List<T, Allocator, Stats>::end() const {
+   return const_iterator(0, this);
+}
+
+/**
+ * Insert an item directly before the element an iterator refers to
+ * 
+ * Preconditions: position is an iterator into this list; end() appends
+ * Postcondition: item is inserted before *position. An iterator to the new
+ *    element is returned. Existing iterators remain valid.
+ * 
+ * Worst-case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::insertBefore(iterator position, const T& item) {
+   Node * newNode = createNode();
+   newNode->data = item;
+   this->countCopies(1);
+   linkBefore(newNode, position._node);
+   
+   // the position of the remembered node is no longer known
+   _cursor = 0;
+   
+   return iterator(newNode, this);
+}
+
+/**
+ * Remove the element an iterator refers to
+ * 
+ * Preconditions: position refers to an element of this list (not end())
+ * Postcondition: The element has been removed. An iterator to the element
+ *    that followed it is returned. Iterators to the removed element are
+ *    invalidated.
+ * 
+ * Worst-case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::erase(iterator position) {
+   Node * ptr = position._node;
+   Node * nextPtr = ptr->next;
+   
+   unlink(ptr);
+   destroyNode(ptr);
+   
+   // the position of the remembered node is no longer known
+   _cursor = 0;
+   
+   return iterator(nextPtr, this);
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Assign a copy of a list object to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: A copy of rhs has been assigned to this object. A const
+ *    reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+const List<T, Allocator, Stats>&
+List<T, Allocator, Stats>::operator=(const List& rhs) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   // copy rhs's elements into a new list
+   copyList(rhs._first);
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Sink>
+bool List<T, Allocator, Stats>::addItemsTo(Sink& sink) const {
+   for (Node * ptr = _first; ptr != 0; ptr = ptr->next) {
+      if (!sink.add(ptr->data)) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this List object has been inserted
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::display(std::ostream& out,
+                                        const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream& out,
+                         const List<T, Allocator, Stats>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Find the node at the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A pointer to the node at position is returned, reached from
+ *    the closest of the first node, the last node and the remembered node.
+ *    The node is remembered for the next walk.
+ * 
+ * Worst-Case Time Complexity: O(min(position, size-position)); O(1)
+ *    amortized when nearby positions are visited in turn
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::findNode(const int& position) const {
+   // start from the closer end of the list
+   Node * ptr = _first;
+   int i = 0;
+   if (_size-1-position < position) {
+      ptr = _last;
+      i = _size-1;
+   }
+   
+   // resume from the remembered node if it is closer still
+   if (_cursor != 0) {
+      int fromCursor = position-_cursorPosition;
+      if (fromCursor < 0) {
+         fromCursor = -fromCursor;
+      }
+      
+      int fromEnd = position-i;
+      if (fromEnd < 0) {
+         fromEnd = -fromEnd;
+      }
+      
+      if (fromCursor < fromEnd) {
+         ptr = _cursor;
+         i = _cursorPosition;
+      }
+   }
+   
+   this->countLinks(position>i ? position-i : i-position);
+   for (; i<position; ++i) {
+      ptr = ptr->next;
+   }
+   for (; i>position; --i) {
+      ptr = ptr->prev;
+   }
+   
+   _cursor = ptr;
+   _cursorPosition = position;
+   
+   return ptr;
+}
+
+/**
+ * Link a node into the list
+ * 
+ * Precondition: node is not in the list; successor is a node of the list, or
+ *    0 to link node in at the end
+ * Postcondition: node is linked in directly before successor and the size
+ *    has been incremented. _cursorPosition is not adjusted.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::linkBefore(Node * node, Node * successor) {
+   Node * predecessor = (successor == 0 ? _last : successor->prev);
+   
+   node->prev = predecessor;
+   node->next = successor;
+   
+   if (predecessor == 0) {
+      _first = node;
+   } else {
+      predecessor->next = node;
+   }
+   
+   if (successor == 0) {
+      _last = node;
+   } else {
+      successor->prev = node;
+   }
+   
+   ++_size;
+}
+
+/**
+ * Unlink a node from the list
+ * 
+ * Precondition: node is in the list
+ * Postcondition: node's neighbours (or _first and _last) bypass it and the
+ *    size has been decremented. node itself is not destroyed.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::unlink(Node * node) {
+   if (node->prev == 0) {
+      _first = node->next;
+   } else {
+      node->prev->next = node->next;
+   }
+   
+   if (node->next == 0) {
+      _last = node->prev;
+   } else {
+      node->next->prev = node->prev;
+   }
+   
+   --_size;
+}
+
+/**
+ * Copy a linked list
+ * 
+ * Precondition: originalListFirst is the first node of the list to be copied
+ * Postcondition: This list holds a copy of the elements of that list; its
+ *    previous elements have been deleted.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::copyList(const Node * originalListFirst) {
+   // if there is already a list held where the copied list should go, then
+   // delete that list
+   deleteList(_first);
+   _first = 0;
+   _last = 0;
+   _size = 0;
+   _cursor = 0;
+   
+   // append a copy of each node
+   for (const Node * ptr = originalListFirst; ptr != 0; ptr = ptr->next) {
+      Node * newNode = createNode();
+      newNode->data = ptr->data;
+      this->countCopies(1);
+      linkBefore(newNode, 0);
+   }
+   
+   return true;
+}
+
+/**
+ * Delete a linked list
+ * 
+ * Precondition: The life of the linked list is over. firstPtr is the first
+ *    node of this list, so every node the pool has handed out is in it.
+ * Postcondition: The memory dynamically allocated by each node of the linked
+ *    list is returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(number of chunks) when T has a trivial
+ *    destructor and the allocator releases in bulk; O(n) otherwise
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::deleteList(Node * firstPtr) {
+   if (Allocator<Node>::BULK_RELEASE) {
+      // the nodes only need to be visited if they have destructors to run
+      if (!std::is_trivially_destructible<T>::value) {
+         for (Node * ptr = firstPtr; ptr != 0; ptr = ptr->next) {
+            ptr->~Node();
+         }
+      }
+      
+      _pool.releaseAll();
+      
+      return true;
+   }
+   
+   Node * ptr = firstPtr;
+   
+   while (ptr != 0) {
+      Node * tempPtr = ptr;
+      ptr = ptr->next;
+      destroyNode(tempPtr);
+   }
+   
+   return true;
+}
+
+/**
+ * Create a node
+ * 
+ * Precondition: N/A
+ * Postcondition: A default-constructed node, allocated from _pool, is
+ *    returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::createNode() {
+   this->countAllocation(sizeof(Node));
+   
+   return new (_pool.allocate()) Node;
+}
+
+/**
+ * Destroy a node
+ * 
+ * Precondition: node was created by createNode and is no longer linked into
+ *    the list
+ * Postcondition: The node has been destroyed and its memory returned to
+ *    _pool.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::destroyNode(Node * node) {
+   node->~Node();
+   _pool.deallocate(node);
+}
+
+#endif /*DOUBLY_LINKED_LIST_H_*/
@@ -1,38 +1,101 @@
 #ifndef DYNAMIC_ARRAY_LIST_H_
 #define DYNAMIC_ARRAY_LIST_H_
 
+#include <atomic>
+#include <functional>
 #include <iostream>
-#include <cassert>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "arraySearch.h"
+#include "arraySort.h"
+#include "arrayStorage.h"
+#include "listFile.h"
+#include "listStats.h"
+#include "listWriter.h"
 
 const int DEFAULT_SIZE = 1024;
 
-template <typename T> class List;
-template <typename T> std::ostream& operator<<(std::ostream&, const List<T>&);
+template <typename T, class Stats = LIST_STATS> class List;
+template <typename T, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Stats>&);
 
 
-template <class T>
-class List {
+template <class T, class Stats>
+class List : private Stats {
    public:
-      List(const int&);
+      List(const int& capacity=DEFAULT_SIZE);
       List(const List&);
+      List(List&&) noexcept;
       
       ~List();
       
       int getSize() const;
       int getCapacity() const;
-
+      const Stats& getStats() const;
+      double getGrowthFactor() const;
+      
       bool isEmpty() const;
+      bool isShared() const;
+      
+      int find(const T&, const int&) const;
+      int indexOf(const T&) const;
+      int count(const T&) const;
+      bool contains(const T&) const;
+      
       bool insert(const T&, const int&);
+      bool insert(T&&, const int&);
       bool remove(const int&);
       
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      void sort();
+      template <class Compare>
+      void sort(Compare);
+      
+      bool reserve(const int&);
+      bool shrinkToFit();
+      bool setGrowthFactor(const double&);
+      void setAutoShrink(const bool&);
+      void setCopyOnWrite(const bool&);
+      
       const List& operator=(const List& rhs);
-
-      void display(std::ostream&) const;
-      friend std::ostream& operator<< <>(std::ostream&, const List<T>&);
+      const List& operator=(List&& rhs) noexcept;
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = false;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      bool write(std::ostream&) const;
+      bool read(std::istream&);
+      friend std::ostream& operator<< <>(std::ostream&, const List<T, Stats>&);
    private:
-      T* _items; // array to store list elements
+      // array to store list elements. Only the first _size slots hold
+      // constructed objects; the rest is raw memory.
+      T* _items;
       int _capacity; // current amount of allocated memory
       int _size; // current size of the list stored in _items
+      
+      double _growthFactor; // multiplier applied to _capacity when full
+      
+      // automatic shrinking never takes the array below _minCapacity
+      int _minCapacity;
+      bool _autoShrink;
+      
+      // with copy-on-write on, the number of lists sharing _items; 0 when it
+      // is off. Copies share the array until one of them changes it, and the
+      // shared array is never changed.
+      std::atomic<int> * _references;
+      
+      bool resize(const int&);
+      bool makeRoom(const int&, const int&);
+      bool unshare(const int&);
+      void releaseItems();
 };
 
 /*****************************************************************************/
@@ -49,13 +112,18 @@ class List {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-List<T>::List(const int& capacity=DEFAULT_SIZE) {
+template <class T, class Stats>
+List<T, Stats>::List(const int& capacity) {
    _capacity = capacity;
-   _items = new(std::nothrow) T[_capacity];
+   _items = allocateItems<T>(_capacity);
+   this->countAllocation(_capacity*sizeof(T));
    _size = 0;
    
-   assert(_items != 0);
+   _growthFactor = DEFAULT_GROWTH_FACTOR;
+   _minCapacity = capacity;
+   _autoShrink = true;
+   
+   _references = 0;
 }
 
 /**
@@ -63,22 +131,58 @@ List<T>::List(const int& capacity=DEFAULT_SIZE) {
  * 
  * Precondition: A copy of originalList is needed. originalList is a const
  *    reference parameter
- * Postcondition: A copy of originalList has been constructed.
+ * Postcondition: A copy of originalList has been constructed. If
+ *    originalList is in copy-on-write mode, the copy shares its array and is
+ *    in copy-on-write mode too.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(n); O(1) in copy-on-write mode
  */
-template <class T>
-List<T>::List(const List& originalList) {
+template <class T, class Stats>
+List<T, Stats>::List(const List& originalList) {
    _capacity = originalList._capacity;
    _size = originalList._size;
    
-   _items = new(std::nothrow) T[_capacity];
-   
-   assert(_items != 0);
+   _growthFactor = originalList._growthFactor;
+   _minCapacity = originalList._minCapacity;
+   _autoShrink = originalList._autoShrink;
    
-   for (int i=0; i<_size; ++i) {
-      _items[i] = originalList._items[i];
+   _references = originalList._references;
+   if (_references != 0) {
+      _references->fetch_add(1);
+      _items = originalList._items;
+      return;
    }
+   
+   _items = allocateItems<T>(_capacity);
+   this->countAllocation(_capacity*sizeof(T));
+   copyItems(originalList._items, _items, _size);
+   this->countCopies(_size);
+}
+
+/**
+ * Construct a list object by taking over the array of another list.
+ * 
+ * Precondition: originalList is an rvalue whose contents are no longer needed
+ * Postcondition: This list holds the elements originalList held, without any
+ *    of them being copied. originalList is an empty list with capacity 0.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+List<T, Stats>::List(List&& originalList) noexcept {
+   _items = originalList._items;
+   _capacity = originalList._capacity;
+   _size = originalList._size;
+   
+   _growthFactor = originalList._growthFactor;
+   _minCapacity = originalList._minCapacity;
+   _autoShrink = originalList._autoShrink;
+   _references = originalList._references;
+   
+   originalList._items = 0;
+   originalList._capacity = 0;
+   originalList._size = 0;
+   originalList._references = 0;
 }
 
 /*****************************************************************************/
@@ -89,14 +193,15 @@ List<T>::List(const List& originalList) {
  * Destroy a list object
  * 
  * Precondition: The life of the object is over.
- * Postcondition: The memory dynamically allocated by the constructor for the
- *    array pointed to by _items has been returned to the heap.
+ * Postcondition: The elements of the list have been destroyed and the memory
+ *    dynamically allocated for the array pointed to by _items has been
+ *    returned to the heap, unless other lists still share the array.
  * 
- * Worst-Case Time Complexity: O(1)
+ * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-List<T>::~List() {
-   delete [] _items;
+template <class T, class Stats>
+List<T, Stats>::~List() {
+   releaseItems();
 }
 
 /*****************************************************************************/
@@ -111,8 +216,8 @@ List<T>::~List() {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getSize() const {
+template <class T, class Stats>
+int List<T, Stats>::getSize() const {
    return _size;
 }
 
@@ -124,11 +229,39 @@ int List<T>::getSize() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getCapacity() const {
+template <class T, class Stats>
+int List<T, Stats>::getCapacity() const {
    return _capacity;
 }
 
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+const Stats& List<T, Stats>::getStats() const {
+   return *this;
+}
+
+/**
+ * Get the growth factor of a list object.
+ * 
+ * Precondition: N/A
+ * Postcondition: The factor by which the capacity is multiplied when an insert
+ *    finds the array full is returned
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+double List<T, Stats>::getGrowthFactor() const {
+   return _growthFactor;
+}
+
 /**
  * Check if a list is empty
  * 
@@ -137,11 +270,88 @@ int List<T>::getCapacity() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-bool List<T>::isEmpty() const {
+template <class T, class Stats>
+bool List<T, Stats>::isEmpty() const {
    return _size==0;
 }
 
+/**
+ * Check if the list shares its array with a copy-on-write copy
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if another list holds the same array, so the
+ *    next change to either list will copy it, and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::isShared() const {
+   return _references!=0 && _references->load()>1;
+}
+
+/**
+ * Find an item, starting from a position
+ * 
+ * Precondition: 0 <= start <= size
+ * Postcondition: The first position at or after start holding an element
+ *    equal to item is returned, or -1 if there is none or start is out of
+ *    range. Arithmetic elements are compared a vector at a time (see
+ *    arraySearch.h).
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+int List<T, Stats>::find(const T& item, const int& start) const {
+   if (start<0 || start>_size) {
+      return -1;
+   }
+   
+   int position = findItem(_items+start, _size-start, item);
+   
+   return position < 0 ? -1 : start+position;
+}
+
+/**
+ * Find the first occurrence of an item
+ * 
+ * Precondition: N/A
+ * Postcondition: The position of the first element equal to item is
+ *    returned, or -1 if there is none.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+int List<T, Stats>::indexOf(const T& item) const {
+   return findItem(_items, _size, item);
+}
+
+/**
+ * Count the occurrences of an item
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements equal to item is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+int List<T, Stats>::count(const T& item) const {
+   return countItems(_items, _size, item);
+}
+
+/**
+ * Check if the list holds an item
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if an element equal to item is in the list and
+ *    false otherwise
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::contains(const T& item) const {
+   return findItem(_items, _size, item) >= 0;
+}
+
 /*****************************************************************************/
 /********************** Functions ********************************************/
 /*****************************************************************************/
@@ -155,31 +365,43 @@ bool List<T>::isEmpty() const {
  * 
  * Worst-case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::insert(const T& item, const int& position) {   
+template <class T, class Stats>
+bool List<T, Stats>::insert(const T& item, const int& position) {   
    if (position<0 || position>_size) {
       return false;
    }
    
-   if (_size == _capacity) {
-      T * copiedItems = new T[_capacity*2];
-      for (int i=0; i<_capacity; ++i) {
-         copiedItems[i] = _items[i];
-      }
-      
-      delete [] _items;
-      
-      _items = copiedItems;
-      _capacity *= 2;
-   }
+   makeRoom(position, 1);
+   
+   // construct the new element in the correct position
+   new (_items+position) T(item);
+   this->countCopies(1);
+   
+   // increment the size of the current list
+   ++_size;
    
-   // shift elements to the right to make space for the new element
-   for (int i=_size; i>position; --i) {
-      _items[i] = _items[i-1];
+   return true;
+}
+
+/**
+ * Move an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item has been moved into the list at the specified position.
+ * 
+ * Worst-case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::insert(T&& item, const int& position) {   
+   if (position<0 || position>_size) {
+      return false;
    }
    
-   // put the new element in the correct position
-   _items[position]=item;
+   makeRoom(position, 1);
+   
+   // construct the new element in the correct position
+   new (_items+position) T(std::move(item));
+   this->countMoves(1);
    
    // increment the size of the current list
    ++_size;
@@ -195,8 +417,8 @@ bool List<T>::insert(const T& item, const int& position) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::remove(const int& position) {
+template <class T, class Stats>
+bool List<T, Stats>::remove(const int& position) {
    // verify we can delete an element
    if (_size==0) {
       return false;
@@ -207,16 +429,219 @@ bool List<T>::remove(const int& position) {
       return false;
    }
    
-   // shift the array left
-   for (int i=position; i<_size; ++i) {
-      _items[i]=_items[i+1];
+   return removeRange(position, position+1);
+}
+
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are forward iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The array grows at most once and the elements
+ *    after position are shifted only once.
+ * 
+ * Worst-case Time Complexity: O(n+k), k being the number of items inserted
+ */
+template <class T, class Stats>
+template <class Iterator>
+bool List<T, Stats>::insertRange(Iterator first, Iterator last,
+                                 const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   int count = static_cast<int>(std::distance(first, last));
+   if (count<0) {
+      return false;
+   }
+   
+   makeRoom(position, count);
+   
+   // construct the new elements in the gap
+   for (int i=position; first!=last; ++first, ++i) {
+      new (_items+i) T(*first);
+   }
+   this->countCopies(count);
+   
+   _size += count;
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. The elements
+ *    after them are shifted left only once.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   unshare(_capacity);
+   
+   // shift the array left over the removed elements
+   closeGap(_items, _size, from, to);
+   this->countShifts(from<to ? _size-to : 0);
+   
+   _size -= to-from;
+   
+   // give memory back once the list is well below capacity
+   if (_autoShrink) {
+      int newCapacity = shrunkCapacity(_capacity, _size, _minCapacity);
+      if (newCapacity != _capacity) {
+         resize(newCapacity);
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Stats>
+void List<T, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare. Equal elements may
+ *    have changed order. The list is sorted in place by introsort (see
+ *    arraySort.h).
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Stats>
+template <class Compare>
+void List<T, Stats>::sort(Compare compare) {
+   unshare(_capacity);
+   
+   sortItems(_items, _size, compare);
+}
+
+/**
+ * Reserve memory for at least capacity elements
+ * 
+ * Preconditions: capacity >= 0
+ * Postconditions: getCapacity() >= capacity. Up to capacity elements can be
+ *    inserted without reallocating the array. Returns false if capacity is
+ *    negative.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::reserve(const int& capacity) {
+   if (capacity<0) {
+      return false;
+   }
+   
+   if (capacity > _capacity) {
+      resize(capacity);
    }
    
-   --_size;
+   return true;
+}
+
+/**
+ * Release any unused memory
+ * 
+ * Preconditions: N/A
+ * Postconditions: The capacity of the list equals its size (or 1, for an
+ *    empty list).
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::shrinkToFit() {
+   int newCapacity = (_size>0 ? _size : 1);
+   
+   if (newCapacity < _minCapacity) {
+      _minCapacity = newCapacity;
+   }
+   
+   if (newCapacity != _capacity) {
+      resize(newCapacity);
+   }
    
    return true;
 }
 
+/**
+ * Set the factor by which the capacity grows when the array is full
+ * 
+ * Preconditions: growthFactor > 1 (typically 1.5 or 2)
+ * Postconditions: Subsequent growth multiplies the capacity by growthFactor.
+ *    Returns false, leaving the factor unchanged, if growthFactor <= 1.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::setGrowthFactor(const double& growthFactor) {
+   if (growthFactor <= 1.0) {
+      return false;
+   }
+   
+   _growthFactor = growthFactor;
+   
+   return true;
+}
+
+/**
+ * Enable or disable automatic shrinking on remove
+ * 
+ * Preconditions: N/A
+ * Postconditions: If autoShrink is true, remove halves the array whenever the
+ *    list falls below 1/SHRINK_DIVISOR of its capacity, but never below the
+ *    capacity the list was constructed with.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+void List<T, Stats>::setAutoShrink(const bool& autoShrink) {
+   _autoShrink = autoShrink;
+}
+
+/**
+ * Enable or disable copy-on-write copies
+ * 
+ * Preconditions: N/A
+ * Postconditions: If copyOnWrite is true, copies of this list (by copy
+ *    construction or assignment) share its array in O(1), and whichever list
+ *    is changed first makes its own copy of the array then. If it is false,
+ *    the list has an array of its own and copies of it are deep copies.
+ * 
+ * Worst-Case Time Complexity: O(1); O(n) to turn copy-on-write off while the
+ *    array is shared
+ */
+template <class T, class Stats>
+void List<T, Stats>::setCopyOnWrite(const bool& copyOnWrite) {
+   if (copyOnWrite && _references==0) {
+      _references = new std::atomic<int>(1);
+   } else if (!copyOnWrite && _references!=0) {
+      unshare(_capacity);
+      delete _references;
+      _references = 0;
+   }
+}
+
 /*****************************************************************************/
 /********************** Operators ********************************************/
 /*****************************************************************************/
@@ -226,34 +651,103 @@ bool List<T>::remove(const int& position) {
  * 
  * Preconditions: N/A
  * Postconditions: A copy of rhs has been assigned to this object. A const
- *    reference to this list is returned.
+ *    reference to this list is returned. If rhs is in copy-on-write mode,
+ *    this list now shares its array and is in copy-on-write mode too.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(n); O(1) plus destroying the previous
+ *    elements in copy-on-write mode
  */
-template <class T>
-const List<T>& List<T>::operator=(const List& rhs) {
+template <class T, class Stats>
+const List<T, Stats>& List<T, Stats>::operator=(const List& rhs) {
    // verify this is not a self-assignment
    if (this == &rhs) { 
       return *this;
    }
    
+   if (_references != 0 || rhs._references != 0) {
+      // count the new reference first, in case both already share an array
+      if (rhs._references != 0) {
+         rhs._references->fetch_add(1);
+      }
+      releaseItems();
+      
+      _references = rhs._references;
+      _capacity = rhs._capacity;
+      _size = rhs._size;
+      
+      _growthFactor = rhs._growthFactor;
+      _minCapacity = rhs._minCapacity;
+      _autoShrink = rhs._autoShrink;
+      
+      if (_references != 0) {
+         _items = rhs._items;
+      } else {
+         _items = allocateItems<T>(_capacity);
+         this->countAllocation(_capacity*sizeof(T));
+         copyItems(rhs._items, _items, _size);
+         this->countCopies(_size);
+      }
+      
+      return *this;
+   }
+   
+   destroyItems(_items, _size);
+   
    // allocate a new array, if necessary
    if (_capacity != rhs._capacity) {
-      delete [] _items;
+      deallocateItems(_items);
       
       _capacity = rhs._capacity;
       
-      _items = new(std::nothrow) T[_capacity];
-      
-      assert(_items != 0);
+      _items = allocateItems<T>(_capacity);
+      this->countAllocation(_capacity*sizeof(T));
    }
    
+   _growthFactor = rhs._growthFactor;
+   _minCapacity = rhs._minCapacity;
+   _autoShrink = rhs._autoShrink;
+   
    // copy rhs's elements into the new array
    _size = rhs._size;
-   for (int i=0; i<_size; ++i) {
-      _items[i] = rhs._items[i];
+   copyItems(rhs._items, _items, _size);
+   this->countCopies(_size);
+   
+   return *this;
+}
+
+/**
+ * Move a list object into the current object
+ * 
+ * Preconditions: rhs is an rvalue whose contents are no longer needed
+ * Postconditions: This list holds rhs's elements without any of them being
+ *    copied; its previous elements have been destroyed. rhs is an empty list
+ *    with capacity 0. A const reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n) to destroy the previous elements
+ */
+template <class T, class Stats>
+const List<T, Stats>& List<T, Stats>::operator=(List&& rhs) noexcept {
+   // verify this is not a self-assignment
+   if (this == &rhs) { 
+      return *this;
    }
    
+   releaseItems();
+   
+   _items = rhs._items;
+   _capacity = rhs._capacity;
+   _size = rhs._size;
+   
+   _growthFactor = rhs._growthFactor;
+   _minCapacity = rhs._minCapacity;
+   _autoShrink = rhs._autoShrink;
+   _references = rhs._references;
+   
+   rhs._items = 0;
+   rhs._capacity = 0;
+   rhs._size = 0;
+   rhs._references = 0;
+   
    return *this;
 }
 
@@ -261,23 +755,100 @@ const List<T>& List<T>::operator=(const List& rhs) {
 /********************** Input/Output *****************************************/
 /*****************************************************************************/
 
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, class Stats>
+template <class Sink>
+bool List<T, Stats>::addItemsTo(Sink& sink) const {
+   for (int i=0; i<_size; ++i) {
+      if (!sink.add(_items[i])) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
 /**
  * Output the list
  * 
- * Precondition: The ostream, out, is open.
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
  * Postcondition: The list represented by this List object has been inserted
- *    into out.
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, class Stats>
+void List<T, Stats>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Write the list to a binary list file
+ * 
+ * Precondition: out is open in binary mode; T is trivially copyable
+ * Postcondition: The list has been written to out in the format of
+ *    listFile.h, its elements in one block. Return true if out is still
+ *    good, and false otherwise.
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-void List<T>::display(std::ostream& out) const {
-   for (int i=0; i<_size; ++i) {
-      out << _items[i];
-      if (i+1<_size) {
-         out << " ";
-      }
+template <class T, class Stats>
+bool List<T, Stats>::write(std::ostream& out) const {
+   return writeListFileHeader<T>(out, _size) &&
+          writeListFileItems(out, _items, _size);
+}
+
+/**
+ * Replace the list with one read from a binary list file
+ * 
+ * Precondition: in is open in binary mode; T is trivially copyable
+ * Postcondition: If in held a list file of T elements, as written by write,
+ *    the list holds its elements, read in one block, and true is returned.
+ *    If the header was not valid, or in is too short for the elements it
+ *    claims, false is returned and the list is unchanged; if in ended
+ *    before the last element all the same, false is returned and the list
+ *    is empty. Copy-on-write mode is kept, but the list no longer shares its
+ *    array.
+ * 
+ * Worst-Case Time Complexity: O(n + k), k being the number of elements read
+ */
+template <class T, class Stats>
+bool List<T, Stats>::read(std::istream& in) {
+   int count = 0;
+   if (!readListFileHeader<T>(in, count)) {
+      return false;
+   }
+   
+   int capacity = (count>_minCapacity ? count : _minCapacity);
+   T * readItems = allocateItems<T>(capacity);
+   this->countAllocation(capacity*sizeof(T));
+   bool complete = readListFileItems(in, readItems, count);
+   if (!complete) {
+      count = 0;
    }
+   
+   bool copyOnWrite = (_references != 0);
+   releaseItems();
+   _references = (copyOnWrite ? new std::atomic<int>(1) : 0);
+   
+   _items = readItems;
+   _capacity = capacity;
+   _size = count;
+   
+   return complete;
 }
 
 /**
@@ -289,11 +860,132 @@ void List<T>::display(std::ostream& out) const {
  * 
  * Worst-Case Time Comlexity: O(n)
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& out, const List<T>& list) {
+template <typename T, class Stats>
+std::ostream& operator<<(std::ostream& out, const List<T, Stats>& list) {
    list.display(out);
    
    return out;
 }
 
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Move the list into an array of a different capacity
+ * 
+ * Precondition: newCapacity >= size
+ * Postcondition: _items points to a new array of newCapacity elements holding
+ *    the list. The old array has been returned to the heap, or left to the
+ *    lists still sharing it.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::resize(const int& newCapacity) {
+   // a shared array is copied rather than moved from
+   if (unshare(newCapacity)) {
+      return true;
+   }
+   
+   T * copiedItems = allocateItems<T>(newCapacity);
+   this->countAllocation(newCapacity*sizeof(T));
+   
+   moveItems(_items, copiedItems, _size);
+   this->countMoves(_size);
+   
+   deallocateItems(_items);
+   
+   _items = copiedItems;
+   _capacity = newCapacity;
+   
+   return true;
+}
+
+/**
+ * Make count unconstructed slots at position, growing the array if needed
+ * 
+ * Precondition: 0 <= position <= size; count >= 0
+ * Postcondition: The elements at position and beyond have been shifted count
+ *    slots to the right. _items[position..position+count-1] is raw memory,
+ *    ready for the new elements to be constructed in place. The size is
+ *    unchanged.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::makeRoom(const int& position, const int& count) {
+   // grow the array geometrically so that n inserts cost O(n) overall
+   if (count > _capacity-_size) {
+      resize(grownCapacity(_capacity, _size+count, _growthFactor));
+   } else {
+      unshare(_capacity);
+   }
+   
+   // shift elements to the right to make space for the new elements
+   openGap(_items, _size, position, count);
+   this->countShifts(count>0 ? _size-position : 0);
+   
+   return true;
+}
+
+/**
+ * Give the list an array of its own if it shares one
+ * 
+ * Precondition: capacity >= size
+ * Postcondition: If the array was shared with another list, _items points to
+ *    a new array of capacity elements holding a copy of the list, and true is
+ *    returned. Otherwise nothing has changed and false is returned.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) if the array is not shared
+ */
+template <class T, class Stats>
+bool List<T, Stats>::unshare(const int& capacity) {
+   if (!isShared()) {
+      return false;
+   }
+   
+   T * copiedItems = allocateItems<T>(capacity);
+   this->countAllocation(capacity*sizeof(T));
+   copyItems(_items, copiedItems, _size);
+   this->countCopies(_size);
+   
+   // the other lists may have let go of the array in the meantime
+   if (_references->fetch_sub(1) == 1) {
+      destroyItems(_items, _size);
+      deallocateItems(_items);
+      _references->store(1);
+   } else {
+      _references = new std::atomic<int>(1);
+   }
+   
+   _items = copiedItems;
+   _capacity = capacity;
+   
+   return true;
+}
+
+/**
+ * Let go of the array
+ * 
+ * Precondition: N/A
+ * Postcondition: The elements have been destroyed and the array returned to
+ *    the heap, unless other lists still share it. _items and _references no
+ *    longer refer to anything; the caller is responsible for resetting them.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) if other lists share the array
+ */
+template <class T, class Stats>
+void List<T, Stats>::releaseItems() {
+   if (_references != 0) {
+      if (_references->fetch_sub(1) != 1) {
+         return;
+      }
+      delete _references;
+   }
+   
+   destroyItems(_items, _size);
+   deallocateItems(_items);
+}
+
 #endif /*DYNAMIC_ARRAY_LIST_H_*/
@@ -0,0 +1,843 @@
+#ifndef GAP_BUFFER_LIST_H_
+#define GAP_BUFFER_LIST_H_
+
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <utility>
+
+#include "arraySort.h"
+#include "arrayStorage.h"
+#include "listStats.h"
+#include "listWriter.h"
+
+const int DEFAULT_SIZE = 1024;
+
+template <typename T, class Stats = LIST_STATS> class List;
+template <typename T, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Stats>&);
+
+/**
+ * An array list that keeps its unused slots as a gap in the middle of the
+ * array rather than at the end. The elements before the gap sit at the
+ * front of the array and the rest sit at the back:
+ * 
+ *    [ 0 .. _gapStart-1 | gap | _gapStart .. _size-1 ]
+ * 
+ * An edit first moves the gap to its position, shifting only the elements
+ * between the old and the new position, and then inserts into or removes
+ * at the edge of the gap. A run of edits near the same place therefore
+ * costs the distance the gap moves instead of O(n) per edit.
+ * 
+ * Capacity is managed as in dynamicArrayList.h: geometric growth, reserve,
+ * shrinkToFit and automatic shrinking, all through arrayStorage.h.
+ */
+template <class T, class Stats>
+class List : private Stats {
+   public:
+      List(const int& capacity=DEFAULT_SIZE);
+      List(const List&);
+      List(List&&) noexcept;
+      
+      ~List();
+      
+      int getSize() const;
+      int getCapacity() const;
+      const Stats& getStats() const;
+      double getGrowthFactor() const;
+      
+      bool isEmpty() const;
+      bool insert(const T&, const int&);
+      bool insert(T&&, const int&);
+      bool remove(const int&);
+      
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      void sort();
+      template <class Compare>
+      void sort(Compare);
+      
+      bool reserve(const int&);
+      bool shrinkToFit();
+      bool setGrowthFactor(const double&);
+      void setAutoShrink(const bool&);
+      
+      const List& operator=(const List& rhs);
+      const List& operator=(List&& rhs) noexcept;
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = false;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List<T, Stats>&);
+   private:
+      // array to store list elements. The first _gapStart slots and the
+      // last _size-_gapStart slots hold constructed objects; the gap between
+      // them is raw memory.
+      T* _items;
+      int _capacity; // current amount of allocated memory
+      int _size; // current size of the list stored in _items
+      int _gapStart; // position of the first slot of the gap
+      
+      double _growthFactor; // multiplier applied to _capacity when full
+      
+      // automatic shrinking never takes the array below _minCapacity
+      int _minCapacity;
+      bool _autoShrink;
+      
+      int gapLength() const;
+      const T& itemAt(const int&) const;
+      
+      bool resize(const int&);
+      bool moveGap(const int&);
+      bool makeRoom(const int&, const int&);
+      bool copyItemsFrom(const List&);
+      bool destroyAllItems();
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: capacity is a positive integer with default value of
+ *    DEFAULT_SIZE
+ * Postcondition: An empty list, with size 0. The list is now a dynamically
+ *    allocated array with capacity as its capacity, all of it gap.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+List<T, Stats>::List(const int& capacity) {
+   _capacity = capacity;
+   _items = allocateItems<T>(_capacity);
+   this->countAllocation(_capacity*sizeof(T));
+   _size = 0;
+   _gapStart = 0;
+   
+   _growthFactor = DEFAULT_GROWTH_FACTOR;
+   _minCapacity = capacity;
+   _autoShrink = true;
+}
+
+/**
+ * Construct a copy of a List object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A copy of originalList, with its gap in the same place, has
+ *    been constructed.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+List<T, Stats>::List(const List& originalList) {
+   _capacity = originalList._capacity;
+   _size = 0;
+   _gapStart = 0;
+   
+   _growthFactor = originalList._growthFactor;
+   _minCapacity = originalList._minCapacity;
+   _autoShrink = originalList._autoShrink;
+   
+   _items = allocateItems<T>(_capacity);
+   this->countAllocation(_capacity*sizeof(T));
+   copyItemsFrom(originalList);
+}
+
+/**
+ * Construct a list object by taking over the array of another list.
+ * 
+ * Precondition: originalList is an rvalue whose contents are no longer needed
+ * Postcondition: This list holds the elements originalList held, without any
+ *    of them being copied. originalList is an empty list with capacity 0.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+List<T, Stats>::List(List&& originalList) noexcept {
+   _items = originalList._items;
+   _capacity = originalList._capacity;
+   _size = originalList._size;
+   _gapStart = originalList._gapStart;
+   
+   _growthFactor = originalList._growthFactor;
+   _minCapacity = originalList._minCapacity;
+   _autoShrink = originalList._autoShrink;
+   
+   originalList._items = 0;
+   originalList._capacity = 0;
+   originalList._size = 0;
+   originalList._gapStart = 0;
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The elements of the list have been destroyed and the memory
+ *    dynamically allocated for the array pointed to by _items has been
+ *    returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+List<T, Stats>::~List() {
+   destroyAllItems();
+   deallocateItems(_items);
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+int List<T, Stats>::getSize() const {
+   return _size;
+}
+
+/**
+ * Get the capacity of a list object.
+ * 
+ * Precondition: N/A
+ * Postcondition: The capacity of the list is returned
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+int List<T, Stats>::getCapacity() const {
+   return _capacity;
+}
+
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+const Stats& List<T, Stats>::getStats() const {
+   return *this;
+}
+
+/**
+ * Get the growth factor of a list object.
+ * 
+ * Precondition: N/A
+ * Postcondition: The factor by which the capacity is multiplied when an insert
+ *    finds the array full is returned
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+double List<T, Stats>::getGrowthFactor() const {
+   return _growthFactor;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::isEmpty() const {
+   return _size==0;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Insert an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item is inserted into the list at the specified position,
+ *    and the gap now starts just after it.
+ * 
+ * Worst-case Time Complexity: O(distance the gap moves); O(n) if the array
+ *    has to grow
+ */
+template <class T, class Stats>
+bool List<T, Stats>::insert(const T& item, const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   makeRoom(position, 1);
+   
+   // construct the new element at the start of the gap
+   new (_items+_gapStart) T(item);
+   this->countCopies(1);
+   ++_gapStart;
+   ++_size;
+   
+   return true;
+}
+
+/**
+ * Move an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item has been moved into the list at the specified position,
+ *    and the gap now starts just after it.
+ * 
+ * Worst-case Time Complexity: O(distance the gap moves); O(n) if the array
+ *    has to grow
+ */
+template <class T, class Stats>
+bool List<T, Stats>::insert(T&& item, const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   makeRoom(position, 1);
+   
+   // construct the new element at the start of the gap
+   new (_items+_gapStart) T(std::move(item));
+   this->countMoves(1);
+   ++_gapStart;
+   ++_size;
+   
+   return true;
+}
+
+/**
+ * Remove the item at the specified position
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: element at the specified position has been removed.
+ * 
+ * Worst-Case Time Complexity: O(distance the gap moves)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::remove(const int& position) {
+   // verify we can delete an element
+   if (_size==0) {
+      return false;
+   }
+   
+   // verify this is a valid item to delete
+   if (position<0 || position>=_size) {
+      return false;
+   }
+   
+   return removeRange(position, position+1);
+}
+
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are forward iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The gap is moved once and the array grows at
+ *    most once.
+ * 
+ * Worst-case Time Complexity: O(distance the gap moves + k), k being the
+ *    number of items inserted
+ */
+template <class T, class Stats>
+template <class Iterator>
+bool List<T, Stats>::insertRange(Iterator first, Iterator last,
+                                 const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   int count = static_cast<int>(std::distance(first, last));
+   if (count<0) {
+      return false;
+   }
+   
+   makeRoom(position, count);
+   
+   // construct the new elements at the start of the gap
+   for (; first!=last; ++first) {
+      new (_items+_gapStart) T(*first);
+      ++_gapStart;
+      ++_size;
+   }
+   this->countCopies(count);
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed by moving the
+ *    gap to from and widening it over them. The array is halved while the
+ *    list is below 1/SHRINK_DIVISOR of its capacity, as in dynamicArrayList.
+ * 
+ * Worst-Case Time Complexity: O(distance the gap moves + (to-from))
+ */
+template <class T, class Stats>
+bool List<T, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   moveGap(from);
+   
+   // the removed elements are the first ones after the gap
+   destroyItems(_items+_gapStart+gapLength(), to-from);
+   _size -= to-from;
+   
+   // give memory back once the list is well below capacity
+   if (_autoShrink) {
+      int newCapacity = shrunkCapacity(_capacity, _size, _minCapacity);
+      if (newCapacity != _capacity) {
+         resize(newCapacity);
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Stats>
+void List<T, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare. Equal elements may
+ *    have changed order. The list is sorted in place by introsort (see
+ *    arraySort.h).
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, class Stats>
+template <class Compare>
+void List<T, Stats>::sort(Compare compare) {
+   // close the gap, so the elements are one contiguous run
+   moveGap(_size);
+   
+   sortItems(_items, _size, compare);
+}
+
+/**
+ * Reserve memory for at least capacity elements
+ * 
+ * Preconditions: capacity >= 0
+ * Postconditions: getCapacity() >= capacity. Up to capacity elements can be
+ *    inserted without reallocating the array. Returns false if capacity is
+ *    negative.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::reserve(const int& capacity) {
+   if (capacity<0) {
+      return false;
+   }
+   
+   if (capacity > _capacity) {
+      resize(capacity);
+   }
+   
+   return true;
+}
+
+/**
+ * Release any unused memory
+ * 
+ * Preconditions: N/A
+ * Postconditions: The capacity of the list equals its size (or 1, for an
+ *    empty list), leaving no gap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::shrinkToFit() {
+   int newCapacity = (_size>0 ? _size : 1);
+   
+   if (newCapacity < _minCapacity) {
+      _minCapacity = newCapacity;
+   }
+   
+   if (newCapacity != _capacity) {
+      resize(newCapacity);
+   }
+   
+   return true;
+}
+
+/**
+ * Set the factor by which the capacity grows when the array is full
+ * 
+ * Preconditions: growthFactor > 1 (typically 1.5 or 2)
+ * Postconditions: Subsequent growth multiplies the capacity by growthFactor.
+ *    Returns false, leaving the factor unchanged, if growthFactor <= 1.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::setGrowthFactor(const double& growthFactor) {
+   if (growthFactor <= 1.0) {
+      return false;
+   }
+   
+   _growthFactor = growthFactor;
+   
+   return true;
+}
+
+/**
+ * Enable or disable automatic shrinking on remove
+ * 
+ * Preconditions: N/A
+ * Postconditions: If autoShrink is true, remove halves the array whenever the
+ *    list falls below 1/SHRINK_DIVISOR of its capacity, but never below the
+ *    capacity the list was constructed with.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+void List<T, Stats>::setAutoShrink(const bool& autoShrink) {
+   _autoShrink = autoShrink;
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Assign a copy of a list object to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: A copy of rhs has been assigned to this object. A const
+ *    reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+const List<T, Stats>& List<T, Stats>::operator=(const List& rhs) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   destroyAllItems();
+   
+   // allocate a new array, if necessary
+   if (_capacity != rhs._capacity) {
+      deallocateItems(_items);
+      
+      _capacity = rhs._capacity;
+      
+      _items = allocateItems<T>(_capacity);
+      this->countAllocation(_capacity*sizeof(T));
+   }
+   
+   _growthFactor = rhs._growthFactor;
+   _minCapacity = rhs._minCapacity;
+   _autoShrink = rhs._autoShrink;
+   
+   // copy rhs's elements into the new array
+   copyItemsFrom(rhs);
+   
+   return *this;
+}
+
+/**
+ * Move a list object into the current object
+ * 
+ * Preconditions: rhs is an rvalue whose contents are no longer needed
+ * Postconditions: This list holds rhs's elements without any of them being
+ *    copied; its previous elements have been destroyed. rhs is an empty list
+ *    with capacity 0. A const reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n) to destroy the previous elements
+ */
+template <class T, class Stats>
+const List<T, Stats>& List<T, Stats>::operator=(List&& rhs) noexcept {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   destroyAllItems();
+   deallocateItems(_items);
+   
+   _items = rhs._items;
+   _capacity = rhs._capacity;
+   _size = rhs._size;
+   _gapStart = rhs._gapStart;
+   
+   _growthFactor = rhs._growthFactor;
+   _minCapacity = rhs._minCapacity;
+   _autoShrink = rhs._autoShrink;
+   
+   rhs._items = 0;
+   rhs._capacity = 0;
+   rhs._size = 0;
+   rhs._gapStart = 0;
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, class Stats>
+template <class Sink>
+bool List<T, Stats>::addItemsTo(Sink& sink) const {
+   for (int i=0; i<_size; ++i) {
+      if (!sink.add(itemAt(i))) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this List object has been inserted
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, class Stats>
+void List<T, Stats>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T, class Stats>
+std::ostream& operator<<(std::ostream& out, const List<T, Stats>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the length of the gap
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of unused slots is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+int List<T, Stats>::gapLength() const {
+   return _capacity-_size;
+}
+
+/**
+ * Get the element at a position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A reference to the element at position, on whichever side
+ *    of the gap it is, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, class Stats>
+const T& List<T, Stats>::itemAt(const int& position) const {
+   if (position < _gapStart) {
+      return _items[position];
+   }
+   
+   return _items[position+gapLength()];
+}
+
+/**
+ * Move the list into an array of a different capacity
+ * 
+ * Precondition: newCapacity >= size
+ * Postcondition: _items points to a new array of newCapacity elements holding
+ *    the list, with the gap still at _gapStart. The old array has been
+ *    returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::resize(const int& newCapacity) {
+   T * copiedItems = allocateItems<T>(newCapacity);
+   this->countAllocation(newCapacity*sizeof(T));
+   
+   // the elements before the gap stay at the front, the rest at the back
+   int tail = _size-_gapStart;
+   moveItems(_items, copiedItems, _gapStart);
+   moveItems(_items+_capacity-tail, copiedItems+newCapacity-tail, tail);
+   this->countMoves(_size);
+   
+   deallocateItems(_items);
+   
+   _items = copiedItems;
+   _capacity = newCapacity;
+   
+   return true;
+}
+
+/**
+ * Move the gap to a position
+ * 
+ * Precondition: 0 <= position <= size
+ * Postcondition: The gap starts at position. Only the elements between the
+ *    old and the new start of the gap have moved, each by the length of the
+ *    gap.
+ * 
+ * Worst-Case Time Complexity: O(|position - old gap start|)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::moveGap(const int& position) {
+   int length = gapLength();
+   
+   if (position < _gapStart) {
+      // the elements in [position, _gapStart) go to the back side
+      relocateItems(_items+position, _items+position+length,
+                    _gapStart-position);
+      this->countShifts(_gapStart-position);
+   } else if (position > _gapStart) {
+      // the elements in [_gapStart, position) come to the front side
+      relocateItems(_items+_gapStart+length, _items+_gapStart,
+                    position-_gapStart);
+      this->countShifts(position-_gapStart);
+   }
+   
+   _gapStart = position;
+   
+   return true;
+}
+
+/**
+ * Make count unconstructed slots at position, growing the array if needed
+ * 
+ * Precondition: 0 <= position <= size; count >= 0
+ * Postcondition: The gap starts at position and is at least count slots
+ *    long, ready for the new elements to be constructed in place. The size
+ *    is unchanged.
+ * 
+ * Worst-Case Time Complexity: O(distance the gap moves); O(n) if the array
+ *    has to grow
+ */
+template <class T, class Stats>
+bool List<T, Stats>::makeRoom(const int& position, const int& count) {
+   moveGap(position);
+   
+   // grow the array geometrically so that n inserts cost O(n) overall
+   if (count > gapLength()) {
+      resize(grownCapacity(_capacity, _size+count, _growthFactor));
+   }
+   
+   return true;
+}
+
+/**
+ * Copy the elements of another list into this list's array
+ * 
+ * Precondition: This list holds no elements and its capacity equals
+ *    originalList's
+ * Postcondition: The elements of originalList have been copied into the
+ *    same slots, so the gap is in the same place.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, class Stats>
+bool List<T, Stats>::copyItemsFrom(const List& originalList) {
+   int tail = originalList._size-originalList._gapStart;
+   
+   copyItems(originalList._items, _items, originalList._gapStart);
+   copyItems(originalList._items+_capacity-tail, _items+_capacity-tail, tail);
+   this->countCopies(originalList._size);
+   
+   _size = originalList._size;
+   _gapStart = originalList._gapStart;
+   
+   return true;
+}
+
+/**
+ * Destroy every element, keeping the array
+ * 
+ * Precondition: N/A
+ * Postcondition: The list is empty and the whole array is gap.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) for trivially destructible T
+ */
+template <class T, class Stats>
+bool List<T, Stats>::destroyAllItems() {
+   int tail = _size-_gapStart;
+   
+   destroyItems(_items, _gapStart);
+   destroyItems(_items+_capacity-tail, tail);
+   
+   _size = 0;
+   _gapStart = 0;
+   
+   return true;
+}
+
+#endif /*GAP_BUFFER_LIST_H_*/
@@ -0,0 +1,341 @@
+#ifndef HAZARD_POINTERS_H_
+#define HAZARD_POINTERS_H_
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+const int MAX_HAZARD_THREADS = 128; // threads holding hazard pointers at once
+const int HAZARDS_PER_THREAD = 2;
+
+// a thread looks for reclaimable nodes once it has retired this many, so the
+// cost of a scan is spread over at least as many retires as there are hazards
+const int RETIRE_THRESHOLD = 2*MAX_HAZARD_THREADS*HAZARDS_PER_THREAD;
+
+const int CACHE_LINE_SIZE = 64;
+
+/**
+ * Safe memory reclamation for lock-free linked structures.
+ * 
+ * Before a thread dereferences a node it might be racing to free, it stores
+ * the node's address in one of its hazard pointers (protect). A thread that
+ * unlinks a node does not delete it but retires it; retired nodes are only
+ * deleted once no thread's hazard pointers hold them.
+ * 
+ * Every thread that calls acquire claims one of MAX_HAZARD_THREADS records,
+ * shared by all the structures in the program, and gives it back when it
+ * exits. Nodes it retired that are still hazardous at exit are handed over
+ * to the next thread that scans.
+ */
+class HazardPointers {
+   public:
+      static std::atomic<void *> * acquire();
+      
+      template <class Node>
+      static Node * protect(std::atomic<void *>&, const std::atomic<Node *>&);
+      
+      template <class Node>
+      static void retire(Node *);
+   private:
+      // one thread's hazard pointers, alone on their cache line so that
+      // publishing them does not slow down the other threads
+      struct alignas(CACHE_LINE_SIZE) Record {
+         std::atomic<bool> active;
+         std::atomic<void *> hazards[HAZARDS_PER_THREAD];
+      };
+      
+      // a node waiting to be deleted, with the function that deletes it
+      struct Retired {
+         void * node;
+         void (*reclaim)(void *);
+      };
+      
+      class Domain {
+         public:
+            Domain();
+            ~Domain();
+            
+            Record _records[MAX_HAZARD_THREADS];
+            
+            // retired nodes left behind by threads that have exited
+            std::mutex _orphanLock;
+            std::vector<Retired> _orphans;
+      };
+      
+      class ThreadState {
+         public:
+            ThreadState();
+            ~ThreadState();
+            
+            Record * _record; // 0 if every record was taken
+            std::vector<Retired> _retired;
+      };
+      
+      static Domain& domain();
+      static ThreadState& threadState();
+      
+      static void scan(std::vector<Retired>&);
+      
+      template <class Node>
+      static void reclaim(void *);
+};
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the calling thread's hazard pointers
+ * 
+ * Precondition: N/A
+ * Postcondition: A pointer to the thread's HAZARDS_PER_THREAD hazard
+ *    pointers is returned, or 0 if MAX_HAZARD_THREADS other threads hold
+ *    records. The record is claimed on a thread's first call.
+ * 
+ * Worst-Case Time Complexity: O(MAX_HAZARD_THREADS) on a thread's first
+ *    call; O(1) afterwards
+ */
+inline std::atomic<void *> * HazardPointers::acquire() {
+   Record * record = threadState()._record;
+   
+   return record != 0 ? record->hazards : 0;
+}
+
+/**
+ * Load a shared pointer and protect the node it points to
+ * 
+ * Precondition: hazard is one of the calling thread's hazard pointers
+ * Postcondition: The value of source is returned and stored in hazard. It
+ *    was still the value of source after being stored, so the node was not
+ *    yet retired and will not be deleted until hazard is cleared or changed.
+ * 
+ * Worst-Case Time Complexity: O(1) per change to source while it runs
+ */
+template <class Node>
+Node * HazardPointers::protect(std::atomic<void *>& hazard,
+                               const std::atomic<Node *>& source) {
+   Node * node = source.load();
+   
+   while (true) {
+      hazard.store(node);
+      
+      Node * current = source.load();
+      if (current == node) {
+         return node;
+      }
+      
+      node = current;
+   }
+}
+
+/**
+ * Hand over an unlinked node for deletion
+ * 
+ * Precondition: node was allocated with new and can no longer be reached
+ *    from the structure it belonged to
+ * Postcondition: node will be deleted once no hazard pointer holds it. When
+ *    the thread has RETIRE_THRESHOLD nodes waiting, every one that is not
+ *    hazardous is deleted.
+ * 
+ * Worst-Case Time Complexity: O(1) amortized
+ */
+template <class Node>
+void HazardPointers::retire(Node * node) {
+   std::vector<Retired>& retired = threadState()._retired;
+   
+   Retired entry;
+   entry.node = node;
+   entry.reclaim = &HazardPointers::reclaim<Node>;
+   retired.push_back(entry);
+   
+   if (static_cast<int>(retired.size()) >= RETIRE_THRESHOLD) {
+      scan(retired);
+   }
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the records shared by every thread
+ * 
+ * Precondition: N/A
+ * Postcondition: The domain, constructed on first use, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline HazardPointers::Domain& HazardPointers::domain() {
+   static Domain domain;
+   
+   return domain;
+}
+
+/**
+ * Get the calling thread's record and retired nodes
+ * 
+ * Precondition: N/A
+ * Postcondition: The thread's state, constructed on first use, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1); O(MAX_HAZARD_THREADS) on first use
+ */
+inline HazardPointers::ThreadState& HazardPointers::threadState() {
+   thread_local ThreadState state;
+   
+   return state;
+}
+
+/**
+ * Delete every retired node no thread is protecting
+ * 
+ * Precondition: N/A
+ * Postcondition: Any nodes orphaned by exited threads have been moved into
+ *    retired. Every node in retired that is not held by a hazard pointer has
+ *    been deleted and removed from retired.
+ * 
+ * Worst-Case Time Complexity: O(r log h), r being the number of retired
+ *    nodes and h the number of hazard pointers
+ */
+inline void HazardPointers::scan(std::vector<Retired>& retired) {
+   Domain& shared = domain();
+   
+   {
+      std::lock_guard<std::mutex> lock(shared._orphanLock);
+      retired.insert(retired.end(), shared._orphans.begin(),
+                     shared._orphans.end());
+      shared._orphans.clear();
+   }
+   
+   std::vector<void *> hazards;
+   hazards.reserve(MAX_HAZARD_THREADS*HAZARDS_PER_THREAD);
+   for (int i=0; i<MAX_HAZARD_THREADS; ++i) {
+      for (int j=0; j<HAZARDS_PER_THREAD; ++j) {
+         void * node = shared._records[i].hazards[j].load();
+         if (node != 0) {
+            hazards.push_back(node);
+         }
+      }
+   }
+   std::sort(hazards.begin(), hazards.end());
+   
+   // keep the hazardous nodes at the front and delete the rest
+   size_t kept = 0;
+   for (size_t i=0; i<retired.size(); ++i) {
+      if (std::binary_search(hazards.begin(), hazards.end(),
+                             retired[i].node)) {
+         retired[kept] = retired[i];
+         ++kept;
+      } else {
+         retired[i].reclaim(retired[i].node);
+      }
+   }
+   retired.resize(kept);
+}
+
+/**
+ * Delete a retired node
+ * 
+ * Precondition: node points to a Node allocated with new that no thread
+ *    can reach
+ * Postcondition: The node has been deleted.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class Node>
+void HazardPointers::reclaim(void * node) {
+   delete static_cast<Node *>(node);
+}
+
+/*****************************************************************************/
+/********************** Domain ***********************************************/
+/*****************************************************************************/
+
+/**
+ * Construct the shared records
+ * 
+ * Precondition: N/A
+ * Postcondition: Every record is free and holds no hazards.
+ * 
+ * Worst-Case Time Complexity: O(MAX_HAZARD_THREADS)
+ */
+inline HazardPointers::Domain::Domain() {
+   for (int i=0; i<MAX_HAZARD_THREADS; ++i) {
+      _records[i].active.store(false);
+      for (int j=0; j<HAZARDS_PER_THREAD; ++j) {
+         _records[i].hazards[j].store(0);
+      }
+   }
+}
+
+/**
+ * Destroy the shared records
+ * 
+ * Precondition: The program is exiting; no thread uses hazard pointers.
+ * Postcondition: Every orphaned node has been deleted.
+ * 
+ * Worst-Case Time Complexity: O(number of orphaned nodes)
+ */
+inline HazardPointers::Domain::~Domain() {
+   for (size_t i=0; i<_orphans.size(); ++i) {
+      _orphans[i].reclaim(_orphans[i].node);
+   }
+}
+
+/*****************************************************************************/
+/********************** Thread State *****************************************/
+/*****************************************************************************/
+
+/**
+ * Claim a record for the calling thread
+ * 
+ * Precondition: N/A
+ * Postcondition: _record is the first record that was free, now marked
+ *    active, or 0 if there was none.
+ * 
+ * Worst-Case Time Complexity: O(MAX_HAZARD_THREADS)
+ */
+inline HazardPointers::ThreadState::ThreadState() {
+   Domain& shared = domain();
+   
+   _record = 0;
+   for (int i=0; i<MAX_HAZARD_THREADS && _record==0; ++i) {
+      bool active = false;
+      if (shared._records[i].active.compare_exchange_strong(active, true)) {
+         _record = &shared._records[i];
+      }
+   }
+}
+
+/**
+ * Give back the calling thread's record
+ * 
+ * Precondition: The thread is exiting
+ * Postcondition: The thread's hazard pointers are cleared and its record is
+ *    free. Retired nodes that are still hazardous have been orphaned to the
+ *    domain; the rest have been deleted.
+ * 
+ * Worst-Case Time Complexity: O(r log h), as for scan
+ */
+inline HazardPointers::ThreadState::~ThreadState() {
+   if (_record != 0) {
+      for (int j=0; j<HAZARDS_PER_THREAD; ++j) {
+         _record->hazards[j].store(0);
+      }
+   }
+   
+   scan(_retired);
+   
+   if (!_retired.empty()) {
+      Domain& shared = domain();
+      std::lock_guard<std::mutex> lock(shared._orphanLock);
+      shared._orphans.insert(shared._orphans.end(), _retired.begin(),
+                             _retired.end());
+   }
+   
+   if (_record != 0) {
+      _record->active.store(false);
+   }
+}
+
+#endif /*HAZARD_POINTERS_H_*/
@@ -0,0 +1,693 @@
+#ifndef INDEXED_LIST_H_
+#define INDEXED_LIST_H_
+
+#include <iostream>
+#include <new>
+#include <type_traits>
+
+#include "listStats.h"
+#include "listWriter.h"
+#include "nodePool.h"
+
+template <typename T, template <class> class Allocator = NodePool,
+          class Stats = LIST_STATS> class List;
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Allocator, Stats>&);
+
+/**
+ * A list stored as a balanced binary tree whose in-order traversal is the
+ * list. Each node records the size of its subtree, so the node at a
+ * position is found by comparing the position with the size of the left
+ * subtree on the way down, and positions are never stored.
+ * 
+ * The tree is a treap: every node also gets a random priority and parents
+ * outrank their children, which keeps the expected depth O(log n) whatever
+ * the order of the edits. Inserts and removes split the tree at a position
+ * and merge the pieces back together.
+ */
+template <class T, template <class> class Allocator, class Stats>
+class List : private Stats {
+   private:
+      class Node {
+         public:
+            T data;
+            Node * left;
+            Node * right;
+            int size; // the number of nodes in the subtree rooted here
+            unsigned int priority;
+      };
+   public:
+      List();
+      List(const List&);
+      
+      ~List();
+      
+      int getSize() const;
+      int getCapacity() const;
+      const Stats& getStats() const;
+      
+      bool isEmpty() const;
+      bool insert(const T&, const int&);
+      bool remove(const int&);
+      
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      T& operator[](const int&);
+      const T& operator[](const int&) const;
+      
+      const List& operator=(const List&);
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = true;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
+   private:
+      Node * _root; // root of the tree, 0 when the list is empty
+      
+      // state of the generator that draws node priorities
+      unsigned int _random;
+      
+      static int sizeOf(const Node *);
+      static void update(Node *);
+      template <class Sink>
+      static bool addTreeItemsTo(const Node *, Sink&);
+      
+      // the nodes of this list are allocated from, and returned to, _pool
+      Allocator<Node> _pool;
+      
+      // split and merge count the links they follow, so are not static
+      void split(Node *, int, Node * &, Node * &);
+      Node * merge(Node *, Node *);
+      
+      Node * createNode(const T&);
+      void destroyNode(Node *);
+      
+      Node * copyTree(const Node *);
+      bool deleteTree(Node *);
+      void destroyTree(Node *);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty list, with size 0, is created.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List() {
+   _root = 0;
+   _random = 2463534242u;
+}
+
+/**
+ * Construct a copy of a List object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A copy of originalList, with the same tree shape, has been
+ *    constructed.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List(const List& originalList) {
+   _random = originalList._random;
+   _root = copyTree(originalList._root);
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The memory dynamically allocated by the tree has been
+ *    returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::~List() {
+   deleteTree(_root);
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getSize() const {
+   return sizeOf(_root);
+}
+
+/**
+ * Get the capacity of a list object.
+ * 
+ * Note that this function is only provided for compatability with other list
+ * implementations.
+ * 
+ * Precondition: N/A
+ * Postcondition: -1 is returned since a pointer based tree has no predefined
+ *    capacity
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getCapacity() const {
+   return -1;
+}
+
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+const Stats& List<T, Allocator, Stats>::getStats() const {
+   return *this;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::isEmpty() const {
+   return _root==0;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Insert an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item is inserted into the list at the specified position.
+ * 
+ * Worst-case Time Complexity: O(log n) expected
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::insert(const T& item, const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>getSize()) {
+      return false;
+   }
+   
+   // split off the elements before position and put the new one between
+   Node * before;
+   Node * after;
+   split(_root, position, before, after);
+   
+   _root = merge(merge(before, createNode(item)), after);
+   
+   return true;
+}
+
+/**
+ * Remove the item at the specified position
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: element at the specified position has been removed.
+ * 
+ * Worst-Case Time Complexity: O(log n) expected
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::remove(const int& position) {
+   // verify we can delete an element
+   if (_root==0) {
+      return false;
+   }
+   
+   // verify this is a valid item to delete
+   if (position<0 || position>=getSize()) {
+      return false;
+   }
+   
+   return removeRange(position, position+1);
+}
+
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are input iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. They are built into a tree of their own, which
+ *    is merged into the list with a single split.
+ * 
+ * Worst-case Time Complexity: O(k log k + log n) expected, k being the
+ *    number of items inserted
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Iterator>
+bool List<T, Allocator, Stats>::insertRange(Iterator first, Iterator last,
+                                            const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>getSize()) {
+      return false;
+   }
+   
+   // build the new items into a tree of their own
+   Node * items = 0;
+   for (; first!=last; ++first) {
+      items = merge(items, createNode(*first));
+   }
+   
+   Node * before;
+   Node * after;
+   split(_root, position, before, after);
+   
+   _root = merge(merge(before, items), after);
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. They are
+ *    split off as one subtree, which is then deleted.
+ * 
+ * Worst-Case Time Complexity: O(log n + (to-from)) expected
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>getSize()) {
+      return false;
+   }
+   
+   if (from == to) {
+      return true;
+   }
+   
+   Node * before;
+   Node * range;
+   Node * after;
+   split(_root, from, before, range);
+   split(range, to-from, range, after);
+   
+   destroyTree(range);
+   
+   _root = merge(before, after);
+   
+   return true;
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Access the element at the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A reference to the element at position is returned.
+ * 
+ * Worst-Case Time Complexity: O(log n) expected
+ */
+template <class T, template <class> class Allocator, class Stats>
+T& List<T, Allocator, Stats>::operator[](const int& position) {
+   return const_cast<T&>(static_cast<const List&>(*this)[position]);
+}
+
+/**
+ * Access the element at the specified position of a const list
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A const reference to the element at position is returned.
+ * 
+ * Worst-Case Time Complexity: O(log n) expected
+ */
+template <class T, template <class> class Allocator, class Stats>
+const T& List<T, Allocator, Stats>::operator[](const int& position) const {
+   const Node * ptr = _root;
+   int index = position;
+   
+   // the left subtree holds the positions before this node
+   int links = 0;
+   while (index != sizeOf(ptr->left)) {
+      if (index < sizeOf(ptr->left)) {
+         ptr = ptr->left;
+      } else {
+         index -= sizeOf(ptr->left)+1;
+         ptr = ptr->right;
+      }
+      ++links;
+   }
+   this->countLinks(links);
+   
+   return ptr->data;
+}
+
+/**
+ * Assign a copy of a list object to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: A copy of rhs has been assigned to this object. A const
+ *    reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+const List<T, Allocator, Stats>&
+List<T, Allocator, Stats>::operator=(const List& rhs) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   // copy rhs's elements into a new tree
+   deleteTree(_root);
+   _root = copyTree(rhs._root);
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k + log n) expected if sink takes only
+ *    k elements
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Sink>
+bool List<T, Allocator, Stats>::addItemsTo(Sink& sink) const {
+   return addTreeItemsTo(_root, sink);
+}
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this List object has been inserted
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit + log n) expected given a limit
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::display(std::ostream& out,
+                                        const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream& out,
+                         const List<T, Allocator, Stats>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a subtree
+ * 
+ * Precondition: node is the root of a subtree, or 0
+ * Postcondition: The number of nodes in the subtree is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::sizeOf(const Node * node) {
+   return node == 0 ? 0 : node->size;
+}
+
+/**
+ * Recompute the size of a node from its children
+ * 
+ * Precondition: node is not 0; the sizes of its children are correct
+ * Postcondition: node->size is correct.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::update(Node * node) {
+   node->size = sizeOf(node->left)+1+sizeOf(node->right);
+}
+
+/**
+ * Split a tree in two at a position
+ * 
+ * Precondition: 0 <= position <= size of the tree rooted at node
+ * Postcondition: before holds the first position elements and after holds
+ *    the rest, both as valid treaps. The original tree no longer exists.
+ * 
+ * Worst-Case Time Complexity: O(depth of the tree)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::split(Node * node, int position, Node * &before,
+                                      Node * &after) {
+   if (node == 0) {
+      before = 0;
+      after = 0;
+      return;
+   }
+   
+   this->countLinks(1);
+   
+   if (position <= sizeOf(node->left)) {
+      // node and its right subtree come after the split
+      split(node->left, position, before, node->left);
+      after = node;
+   } else {
+      // node and its left subtree come before the split
+      split(node->right, position-sizeOf(node->left)-1, node->right, after);
+      before = node;
+   }
+   
+   update(node);
+}
+
+/**
+ * Join two trees
+ * 
+ * Precondition: before and after are valid treaps (either may be 0)
+ * Postcondition: The root of a treap holding the elements of before followed
+ *    by those of after is returned.
+ * 
+ * Worst-Case Time Complexity: O(depth of the trees)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::merge(Node * before, Node * after) {
+   if (before == 0) {
+      return after;
+   }
+   if (after == 0) {
+      return before;
+   }
+   
+   this->countLinks(1);
+   
+   // the root with the higher priority stays on top
+   if (before->priority > after->priority) {
+      before->right = merge(before->right, after);
+      update(before);
+      return before;
+   }
+   
+   after->left = merge(before, after->left);
+   update(after);
+   return after;
+}
+
+/**
+ * Add a subtree to a sink in order
+ * 
+ * Precondition: sink is as for addItemsTo
+ * Postcondition: The elements of the subtree rooted at node have been added
+ *    to sink, in list order, until it took no more. Return true if it took
+ *    all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(size of the subtree)
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Sink>
+bool List<T, Allocator, Stats>::addTreeItemsTo(const Node * node,
+                                               Sink& sink) {
+   if (node == 0) {
+      return true;
+   }
+   
+   return addTreeItemsTo(node->left, sink) && sink.add(node->data) &&
+          addTreeItemsTo(node->right, sink);
+}
+
+/**
+ * Create a node
+ * 
+ * Precondition: N/A
+ * Postcondition: A leaf node holding a copy of item, with a fresh random
+ *    priority and allocated from _pool, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::createNode(const T& item) {
+   // xorshift, which is plenty random enough to balance the tree
+   _random ^= _random << 13;
+   _random ^= _random >> 17;
+   _random ^= _random << 5;
+   
+   Node * node = new (_pool.allocate()) Node;
+   this->countAllocation(sizeof(Node));
+   node->data = item;
+   this->countCopies(1);
+   node->left = 0;
+   node->right = 0;
+   node->size = 1;
+   node->priority = _random;
+   
+   return node;
+}
+
+/**
+ * Destroy a node
+ * 
+ * Precondition: node was created by createNode and is no longer in the tree
+ * Postcondition: The node has been destroyed and its memory returned to
+ *    _pool.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::destroyNode(Node * node) {
+   node->~Node();
+   _pool.deallocate(node);
+}
+
+/**
+ * Copy a subtree
+ * 
+ * Precondition: node is the root of the subtree to be copied, or 0
+ * Postcondition: The root of a copy of the subtree, with the same shape and
+ *    priorities, is returned.
+ * 
+ * Worst-Case Time Complexity: O(size of the subtree)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::copyTree(const Node * node) {
+   if (node == 0) {
+      return 0;
+   }
+   
+   Node * copiedNode = new (_pool.allocate()) Node;
+   this->countAllocation(sizeof(Node));
+   copiedNode->data = node->data;
+   this->countCopies(1);
+   copiedNode->size = node->size;
+   copiedNode->priority = node->priority;
+   copiedNode->left = copyTree(node->left);
+   copiedNode->right = copyTree(node->right);
+   
+   return copiedNode;
+}
+
+/**
+ * Delete the whole tree
+ * 
+ * Precondition: The life of the tree is over. root is the root of this
+ *    list's tree, so every node the pool has handed out is in it.
+ * Postcondition: The memory dynamically allocated by each node of the tree
+ *    is returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(number of chunks) when T has a trivial
+ *    destructor and the allocator releases in bulk; O(n) otherwise
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::deleteTree(Node * root) {
+   if (Allocator<Node>::BULK_RELEASE &&
+       std::is_trivially_destructible<T>::value) {
+      _pool.releaseAll();
+      return true;
+   }
+   
+   destroyTree(root);
+   _pool.releaseAll();
+   
+   return true;
+}
+
+/**
+ * Destroy a subtree
+ * 
+ * Precondition: node is the root of a subtree that is no longer part of the
+ *    tree, or 0
+ * Postcondition: Every node in the subtree has been destroyed and its memory
+ *    returned to _pool.
+ * 
+ * Worst-Case Time Complexity: O(size of the subtree)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::destroyTree(Node * node) {
+   if (node == 0) {
+      return;
+   }
+   
+   destroyTree(node->left);
+   destroyTree(node->right);
+   destroyNode(node);
+}
+
+#endif /*INDEXED_LIST_H_*/
@@ -0,0 +1,225 @@
+#ifndef LIST_FILE_H_
+#define LIST_FILE_H_
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+
+/*
+ * Binary file format for lists of trivially copyable elements.
+ * 
+ * A list file is a ListFileHeader followed by the elements in list order,
+ * each as the sizeof(T) bytes it occupies in memory, with no padding between
+ * them. Writing and reading are therefore bulk copies, and a file can be
+ * mapped into memory and used in place (see mappedList.h). The header starts
+ * the elements at a 32 byte offset, so any element whose alignment is at
+ * most 32 is aligned in a mapped file.
+ * 
+ * The format is that of the machine that wrote the file. The header records
+ * the element size and the byte order, and files from a machine that differs
+ * in either are rejected rather than misread. Files of another version are
+ * rejected as well.
+ */
+
+const char LIST_FILE_MAGIC[4] = {'L', 'I', 'S', 'T'};
+const std::uint32_t LIST_FILE_VERSION = 1;
+
+// written in the machine's byte order, so a reader can tell if its own differs
+const std::uint32_t LIST_FILE_BYTE_ORDER = 0x01020304;
+
+// lists that do not hold their elements in one array gather them into blocks
+// of about this many bytes, so they are still written and read in large pieces
+const int LIST_FILE_BLOCK_SIZE = 1 << 20;
+
+struct ListFileHeader {
+   char magic[4]; // LIST_FILE_MAGIC
+   std::uint32_t version; // LIST_FILE_VERSION
+   std::uint32_t byteOrder; // LIST_FILE_BYTE_ORDER
+   std::uint32_t itemSize; // sizeof(T)
+   std::uint32_t itemAlignment; // alignof(T)
+   std::uint32_t reserved; // 0
+   std::uint64_t count; // the number of elements that follow
+};
+
+static_assert(sizeof(ListFileHeader) == 32,
+              "list file header must be 32 bytes");
+
+/*****************************************************************************/
+/********************** Header ***********************************************/
+/*****************************************************************************/
+
+/**
+ * Build the header of a list file
+ * 
+ * Precondition: count >= 0
+ * Postcondition: A header for count elements of type T is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+ListFileHeader makeListFileHeader(const int& count) {
+   ListFileHeader header;
+   std::memcpy(header.magic, LIST_FILE_MAGIC, sizeof(header.magic));
+   header.version = LIST_FILE_VERSION;
+   header.byteOrder = LIST_FILE_BYTE_ORDER;
+   header.itemSize = sizeof(T);
+   header.itemAlignment = alignof(T);
+   header.reserved = 0;
+   header.count = static_cast<std::uint64_t>(count);
+   
+   return header;
+}
+
+/**
+ * Check that a header describes a list file this program can read as T
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if header has the current magic, version and
+ *    byte order, the size and alignment of T, and a count a list can hold,
+ *    and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool checkListFileHeader(const ListFileHeader& header) {
+   return std::memcmp(header.magic, LIST_FILE_MAGIC,
+                      sizeof(header.magic)) == 0 &&
+          header.version == LIST_FILE_VERSION &&
+          header.byteOrder == LIST_FILE_BYTE_ORDER &&
+          header.itemSize == sizeof(T) &&
+          header.itemAlignment == alignof(T) &&
+          header.count <= static_cast<std::uint64_t>(INT_MAX);
+}
+
+/**
+ * Write the header of a list file
+ * 
+ * Precondition: out is open in binary mode; count >= 0
+ * Postcondition: The header for count elements of type T has been written to
+ *    out. Return true if out is still good, and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool writeListFileHeader(std::ostream& out, const int& count) {
+   static_assert(std::is_trivially_copyable<T>::value,
+                 "list files hold trivially copyable elements only");
+   
+   ListFileHeader header = makeListFileHeader<T>(count);
+   out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+   
+   return out.good();
+}
+
+/**
+ * Check that a list file has room for the elements its header claims, so a
+ * corrupt count is not trusted with an allocation
+ * 
+ * Precondition: in is open in binary mode, positioned after the header
+ * Postcondition: Return false if in can tell how many bytes are left in it
+ *    and that is fewer than count elements, and true otherwise (including
+ *    for a stream, such as a pipe, that cannot seek). The position of in is
+ *    unchanged.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool listFileHoldsItems(std::istream& in, const std::uint64_t& count) {
+   std::streambuf * buffer = in.rdbuf();
+   if (buffer == 0) {
+      return false;
+   }
+   
+   // seeking the buffer directly leaves the stream's state alone when it
+   // cannot seek
+   std::streampos position = buffer->pubseekoff(0, std::ios_base::cur,
+                                                std::ios_base::in);
+   if (position == std::streampos(-1)) {
+      return true;
+   }
+   
+   std::streampos end = buffer->pubseekoff(0, std::ios_base::end,
+                                           std::ios_base::in);
+   buffer->pubseekpos(position, std::ios_base::in);
+   if (end == std::streampos(-1)) {
+      return true;
+   }
+   
+   std::uint64_t remaining = static_cast<std::uint64_t>(end-position);
+   
+   return count <= remaining/sizeof(T);
+}
+
+/**
+ * Read the header of a list file
+ * 
+ * Precondition: in is open in binary mode
+ * Postcondition: A header has been read from in. If it is a valid header for
+ *    elements of type T, and in holds as many elements as it claims (see
+ *    listFileHoldsItems), count holds the number of elements that follow
+ *    and true is returned. Otherwise count is unchanged and false is
+ *    returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool readListFileHeader(std::istream& in, int& count) {
+   static_assert(std::is_trivially_copyable<T>::value,
+                 "list files hold trivially copyable elements only");
+   
+   ListFileHeader header;
+   in.read(reinterpret_cast<char *>(&header), sizeof(header));
+   if (in.gcount() != static_cast<std::streamsize>(sizeof(header)) ||
+       !checkListFileHeader<T>(header) ||
+       !listFileHoldsItems<T>(in, header.count)) {
+      return false;
+   }
+   
+   count = static_cast<int>(header.count);
+   
+   return true;
+}
+
+/*****************************************************************************/
+/********************** Elements *********************************************/
+/*****************************************************************************/
+
+/**
+ * Write elements to a list file in one block
+ * 
+ * Precondition: out is open in binary mode; items[0..count-1] are
+ *    constructed
+ * Postcondition: The bytes of the elements have been written to out with a
+ *    single write. Return true if out is still good, and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+bool writeListFileItems(std::ostream& out, const T * items, const int& count) {
+   out.write(reinterpret_cast<const char *>(items),
+             static_cast<std::streamsize>(count)*sizeof(T));
+   
+   return out.good();
+}
+
+/**
+ * Read elements from a list file in one block
+ * 
+ * Precondition: in is open in binary mode; items has room for count
+ *    elements
+ * Postcondition: count elements have been read into items with a single
+ *    read. Return true if in held all of them, and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+bool readListFileItems(std::istream& in, T * items, const int& count) {
+   std::streamsize length = static_cast<std::streamsize>(count)*sizeof(T);
+   in.read(reinterpret_cast<char *>(items), length);
+   
+   return in.gcount() == length;
+}
+
+#endif /*LIST_FILE_H_*/
@@ -0,0 +1,263 @@
+#ifndef LIST_STATS_H_
+#define LIST_STATS_H_
+
+#include <atomic>
+#include <cstddef>
+
+/*
+ * Instrumentation policies for the List variants.
+ * 
+ * Every List takes a Stats policy as its last template parameter and calls
+ * it wherever it allocates memory, copies or moves an element into place,
+ * shifts elements to open or close a gap, or follows a link on its way to a
+ * position. The default policy, NoListStats, does nothing: its functions are
+ * empty and inline, and the List inherits from it, so an uninstrumented list
+ * is no bigger and no slower than before. ListStats counts.
+ * 
+ * The default is LIST_STATS, so every list in a program can be instrumented
+ * at once by compiling with -DLIST_STATS=ListStats. A single list can be
+ * chosen by naming the policy as its last template argument, after any
+ * others the variant takes: List<int, ListStats> in dynamicArrayList.h, but
+ * List<int, CAPACITY, ListStats> in arrayList.h and
+ * List<int, NodePool, ListStats> in pointerLinkedList.h. LIST_STATS must be
+ * the same in every translation unit of a program.
+ */
+
+#ifndef LIST_STATS
+#define LIST_STATS NoListStats
+#endif
+
+/**
+ * What a list has done, as counted by ListStats.
+ */
+class ListCounters {
+   public:
+      constexpr ListCounters()
+         : allocations(0), allocatedBytes(0), copies(0), moves(0),
+           shifts(0), links(0) {}
+      
+      // blocks of memory obtained for elements, nodes or segments, and their
+      // total size; a node taken from a NodePool counts as one
+      long long allocations;
+      long long allocatedBytes;
+      
+      long long copies; // elements copy constructed or copy assigned
+      long long moves; // elements move constructed or move assigned
+      
+      // elements moved aside to open a gap in insert or close one in remove
+      long long shifts;
+      
+      // links (next, child or segment pointers) followed to reach a position
+      long long links;
+};
+
+/**
+ * The default policy: counts nothing and costs nothing.
+ */
+class NoListStats {
+   public:
+      static const bool ENABLED = false;
+      
+      constexpr void countAllocation(const std::size_t&) const {}
+      constexpr void countCopies(const long long&) const {}
+      constexpr void countMoves(const long long&) const {}
+      constexpr void countShifts(const long long&) const {}
+      constexpr void countLinks(const long long&) const {}
+      
+      constexpr ListCounters getCounters() const { return ListCounters(); }
+};
+
+/**
+ * The counting policy. Each list keeps its own counters, and every count is
+ * also added to counters shared by all instrumented lists in the program,
+ * which are atomic so lists on different threads can count at once.
+ * 
+ * The counters of a list start at zero when it is constructed; copying or
+ * assigning a list does not copy them. Counting functions are const, since
+ * const operations such as searches follow links too.
+ */
+class ListStats {
+   public:
+      static const bool ENABLED = true;
+      
+      void countAllocation(const std::size_t&) const;
+      void countCopies(const long long&) const;
+      void countMoves(const long long&) const;
+      void countShifts(const long long&) const;
+      void countLinks(const long long&) const;
+      
+      const ListCounters& getCounters() const;
+      
+      static ListCounters getGlobalCounters();
+      static void resetGlobalCounters();
+   private:
+      mutable ListCounters _counters;
+      
+      class GlobalCounters {
+         public:
+            std::atomic<long long> allocations;
+            std::atomic<long long> allocatedBytes;
+            std::atomic<long long> copies;
+            std::atomic<long long> moves;
+            std::atomic<long long> shifts;
+            std::atomic<long long> links;
+      };
+      
+      static GlobalCounters& global();
+};
+
+/*****************************************************************************/
+/********************** Counting *********************************************/
+/*****************************************************************************/
+
+/**
+ * Count a block of memory obtained by the list
+ * 
+ * Precondition: bytes is the size of the block
+ * Postcondition: One allocation of bytes has been added to the list's
+ *    counters and the global ones.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListStats::countAllocation(const std::size_t& bytes) const {
+   ++_counters.allocations;
+   _counters.allocatedBytes += bytes;
+   
+   global().allocations.fetch_add(1, std::memory_order_relaxed);
+   global().allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * Count elements copied into place
+ * 
+ * Precondition: count >= 0
+ * Postcondition: count copies have been added to the list's counters and the
+ *    global ones.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListStats::countCopies(const long long& count) const {
+   _counters.copies += count;
+   global().copies.fetch_add(count, std::memory_order_relaxed);
+}
+
+/**
+ * Count elements moved into place
+ * 
+ * Precondition: count >= 0
+ * Postcondition: count moves have been added to the list's counters and the
+ *    global ones.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListStats::countMoves(const long long& count) const {
+   _counters.moves += count;
+   global().moves.fetch_add(count, std::memory_order_relaxed);
+}
+
+/**
+ * Count elements shifted by an insert or a remove
+ * 
+ * Precondition: count >= 0
+ * Postcondition: count shifts have been added to the list's counters and the
+ *    global ones.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListStats::countShifts(const long long& count) const {
+   _counters.shifts += count;
+   global().shifts.fetch_add(count, std::memory_order_relaxed);
+}
+
+/**
+ * Count links followed to reach a position
+ * 
+ * Precondition: count >= 0
+ * Postcondition: count links have been added to the list's counters and the
+ *    global ones.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListStats::countLinks(const long long& count) const {
+   _counters.links += count;
+   global().links.fetch_add(count, std::memory_order_relaxed);
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the counters of this list
+ * 
+ * Precondition: N/A
+ * Postcondition: What the list has done since it was constructed is
+ *    returned. To count a stretch of work, take the difference of two
+ *    readings.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline const ListCounters& ListStats::getCounters() const {
+   return _counters;
+}
+
+/**
+ * Get the counters of all instrumented lists
+ * 
+ * Precondition: N/A
+ * Postcondition: The totals over every list with ListStats since the
+ *    program started or the global counters were last reset are returned.
+ *    Each total is read atomically, but not all of them at one instant.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline ListCounters ListStats::getGlobalCounters() {
+   ListCounters counters;
+   counters.allocations = global().allocations.load();
+   counters.allocatedBytes = global().allocatedBytes.load();
+   counters.copies = global().copies.load();
+   counters.moves = global().moves.load();
+   counters.shifts = global().shifts.load();
+   counters.links = global().links.load();
+   
+   return counters;
+}
+
+/**
+ * Reset the counters of all instrumented lists
+ * 
+ * Precondition: N/A
+ * Postcondition: The global counters are zero. The counters of each list
+ *    are unchanged.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListStats::resetGlobalCounters() {
+   global().allocations.store(0);
+   global().allocatedBytes.store(0);
+   global().copies.store(0);
+   global().moves.store(0);
+   global().shifts.store(0);
+   global().links.store(0);
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the global counters
+ * 
+ * Precondition: N/A
+ * Postcondition: The counters shared by every instrumented list, which are
+ *    zero at the start of the program, are returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline ListStats::GlobalCounters& ListStats::global() {
+   static GlobalCounters counters;
+   
+   return counters;
+}
+
+#endif /*LIST_STATS_H_*/
@@ -0,0 +1,346 @@
+#ifndef LIST_WRITER_H_
+#define LIST_WRITER_H_
+
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <locale>
+#include <string>
+#include <type_traits>
+
+// display(out) shows every element; display(out, limit) only the first limit
+const int DISPLAY_ALL = -1;
+
+// bytes of text gathered before they are written to the stream at once
+const int LIST_WRITER_BUFFER_SIZE = 1 << 16;
+
+// room a number needs in the buffer: enough for any integer and any
+// floating-point value at a precision of up to MAX_FAST_PRECISION
+const int MAX_NUMBER_TEXT = 128;
+const int MAX_FAST_PRECISION = 64;
+
+/**
+ * Formats the elements of a list for display.
+ * 
+ * The text goes into a buffer of LIST_WRITER_BUFFER_SIZE bytes, which is
+ * written to the stream whenever it fills up and at finish, so a list costs
+ * a handful of large writes instead of two stream insertions per element.
+ * The buffer belongs to the thread and is reused by every writer, so
+ * displaying a list allocates nothing.
+ * 
+ * Integers and floating-point numbers are converted by std::to_chars, and
+ * std::strings are copied in directly. They come out exactly as operator<<
+ * would write them, since this is only done while the stream has its
+ * default flags, width and locale (precision may be anything up to
+ * MAX_FAST_PRECISION). Every other element, and every element while the
+ * stream is set up otherwise, goes through its own operator<<.
+ * 
+ * Elements are separated by spaces. A writer made with terminated set puts a
+ * space after every element instead, as the linked lists always have. Given
+ * a limit, the writer takes that many elements and then writes "..." in
+ * place of the rest.
+ */
+class ListWriter {
+   public:
+      ListWriter(std::ostream&, const int& limit=DISPLAY_ALL,
+                 const bool& terminated=false);
+      
+      template <class T>
+      bool add(const T&);
+      void finish();
+   private:
+      // how an element is turned into text
+      enum Kind { STREAMED, INTEGER, FLOATING, STRING };
+      
+      template <class T>
+      class KindOf {
+         public:
+            static const Kind value =
+               std::is_same<T, bool>::value ||
+               std::is_same<T, char>::value ||
+               std::is_same<T, signed char>::value ||
+               std::is_same<T, unsigned char>::value ||
+               std::is_same<T, wchar_t>::value ||
+               std::is_same<T, char16_t>::value ||
+               std::is_same<T, char32_t>::value ? STREAMED :
+               std::is_integral<T>::value ? INTEGER :
+               std::is_floating_point<T>::value ? FLOATING :
+               std::is_same<T, std::string>::value ? STRING : STREAMED;
+      };
+      
+      std::ostream& _out;
+      
+      char * _buffer; // the thread's buffer
+      char * _cursor; // where the next character goes
+      
+      int _limit; // elements still to be shown, or DISPLAY_ALL
+      bool _terminated;
+      bool _first; // no element has been added yet
+      bool _truncated; // an element was left out because of the limit
+      
+      // whether numbers and strings may be formatted without the stream
+      bool _fast;
+      int _precision;
+      
+      static char * threadBuffer();
+      
+      void separate();
+      void flush();
+      void reserve(const int&);
+      
+      template <class T>
+      void put(const T&, std::integral_constant<Kind, STREAMED>);
+      template <class T>
+      void put(const T&, std::integral_constant<Kind, INTEGER>);
+      template <class T>
+      void put(const T&, std::integral_constant<Kind, FLOATING>);
+      void put(const std::string&, std::integral_constant<Kind, STRING>);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Constructor: start formatting a list for a stream
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: A writer with an empty buffer is created. It will show at
+ *    most limit elements, terminating each with a space if terminated is
+ *    true and separating them with spaces otherwise.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline ListWriter::ListWriter(std::ostream& out, const int& limit,
+                              const bool& terminated)
+   : _out(out) {
+   _buffer = threadBuffer();
+   _cursor = _buffer;
+   
+   _limit = limit;
+   _terminated = terminated;
+   _first = true;
+   _truncated = false;
+   
+   _fast = out.flags() == (std::ios_base::dec | std::ios_base::skipws) &&
+           out.width() == 0 &&
+           out.precision() <= MAX_FAST_PRECISION &&
+           out.getloc() == std::locale::classic();
+   _precision = static_cast<int>(out.precision());
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Add the next element of the list
+ * 
+ * Precondition: T has operator<<
+ * Postcondition: If the limit has not been reached, item has been added to
+ *    the text, after a separator if needed, and true is returned. Otherwise
+ *    nothing has been added and false is returned; the caller need not add
+ *    any more elements.
+ * 
+ * Worst-Case Time Complexity: O(1) for numbers; otherwise that of writing
+ *    item to the stream
+ */
+template <class T>
+bool ListWriter::add(const T& item) {
+   if (_limit == 0) {
+      _truncated = true;
+      return false;
+   }
+   if (_limit > 0) {
+      --_limit;
+   }
+   
+   separate();
+   put(item, std::integral_constant<Kind, KindOf<T>::value>());
+   
+   if (_terminated) {
+      reserve(1);
+      *_cursor++ = ' ';
+   }
+   
+   return true;
+}
+
+/**
+ * Write the text to the stream
+ * 
+ * Precondition: N/A
+ * Postcondition: "..." has been added if elements were left out, and the
+ *    buffered text has been written to the stream in one piece.
+ * 
+ * Worst-Case Time Complexity: O(length of the buffered text)
+ */
+inline void ListWriter::finish() {
+   if (_truncated) {
+      separate();
+      reserve(4);
+      std::memcpy(_cursor, "...", 3);
+      _cursor += 3;
+      if (_terminated) {
+         *_cursor++ = ' ';
+      }
+      _truncated = false;
+   }
+   
+   flush();
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the buffer of the calling thread
+ * 
+ * Precondition: N/A
+ * Postcondition: A buffer of LIST_WRITER_BUFFER_SIZE bytes, the same one on
+ *    every call from the same thread, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline char * ListWriter::threadBuffer() {
+   static thread_local char buffer[LIST_WRITER_BUFFER_SIZE];
+   
+   return buffer;
+}
+
+/**
+ * Add a space before every element but the first
+ * 
+ * Precondition: N/A
+ * Postcondition: A space has been added unless this is the first element or
+ *    elements are terminated rather than separated.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+inline void ListWriter::separate() {
+   if (!_first && !_terminated) {
+      reserve(1);
+      *_cursor++ = ' ';
+   }
+   _first = false;
+}
+
+/**
+ * Write out the buffered text
+ * 
+ * Precondition: N/A
+ * Postcondition: The buffer has been written to the stream and emptied.
+ * 
+ * Worst-Case Time Complexity: O(length of the buffered text)
+ */
+inline void ListWriter::flush() {
+   if (_cursor != _buffer) {
+      _out.write(_buffer, _cursor-_buffer);
+      _cursor = _buffer;
+   }
+}
+
+/**
+ * Make room in the buffer
+ * 
+ * Precondition: 0 <= length <= LIST_WRITER_BUFFER_SIZE
+ * Postcondition: At least length bytes are free, the buffer having been
+ *    flushed if there were fewer.
+ * 
+ * Worst-Case Time Complexity: O(LIST_WRITER_BUFFER_SIZE)
+ */
+inline void ListWriter::reserve(const int& length) {
+   if (_buffer+LIST_WRITER_BUFFER_SIZE-_cursor < length) {
+      flush();
+   }
+}
+
+/**
+ * Add an element with its operator<<
+ * 
+ * Precondition: T has operator<<
+ * Postcondition: The buffer has been flushed and item inserted into the
+ *    stream. The buffer is empty, so item may itself be displayed through a
+ *    ListWriter.
+ * 
+ * Worst-Case Time Complexity: that of writing item to the stream
+ */
+template <class T>
+void ListWriter::put(const T& item, std::integral_constant<Kind, STREAMED>) {
+   flush();
+   _out << item;
+}
+
+/**
+ * Add an integer
+ * 
+ * Precondition: N/A
+ * Postcondition: item has been added in decimal, as operator<< would with
+ *    the default flags.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+void ListWriter::put(const T& item, std::integral_constant<Kind, INTEGER>) {
+   if (!_fast) {
+      put(item, std::integral_constant<Kind, STREAMED>());
+      return;
+   }
+   
+   reserve(MAX_NUMBER_TEXT);
+   _cursor = std::to_chars(_cursor, _cursor+MAX_NUMBER_TEXT, item).ptr;
+}
+
+/**
+ * Add a floating-point number
+ * 
+ * Precondition: N/A
+ * Postcondition: item has been added with the stream's precision in the
+ *    general format, as operator<< would with the default flags.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+void ListWriter::put(const T& item, std::integral_constant<Kind, FLOATING>) {
+   if (!_fast) {
+      put(item, std::integral_constant<Kind, STREAMED>());
+      return;
+   }
+   
+   reserve(MAX_NUMBER_TEXT);
+   std::to_chars_result result =
+      std::to_chars(_cursor, _cursor+MAX_NUMBER_TEXT, item,
+                    std::chars_format::general, _precision);
+   
+   // a value too long for the room reserved is left to the stream
+   if (result.ec != std::errc()) {
+      put(item, std::integral_constant<Kind, STREAMED>());
+      return;
+   }
+   
+   _cursor = result.ptr;
+}
+
+/**
+ * Add a string
+ * 
+ * Precondition: N/A
+ * Postcondition: The characters of item have been added, as operator<<
+ *    would with the default flags.
+ * 
+ * Worst-Case Time Complexity: O(length of item)
+ */
+inline void ListWriter::put(const std::string& item,
+                            std::integral_constant<Kind, STRING>) {
+   if (!_fast || item.size() > LIST_WRITER_BUFFER_SIZE/2) {
+      put(item, std::integral_constant<Kind, STREAMED>());
+      return;
+   }
+   
+   reserve(static_cast<int>(item.size()));
+   std::memcpy(_cursor, item.data(), item.size());
+   _cursor += item.size();
+}
+
+#endif /*LIST_WRITER_H_*/
@@ -0,0 +1,342 @@
+#ifndef LOCK_FREE_QUEUE_H_
+#define LOCK_FREE_QUEUE_H_
+
+#include <atomic>
+#include <iostream>
+#include <new>
+#include <utility>
+
+#include "hazardPointers.h"
+#include "listWriter.h"
+
+template <typename T> class Queue;
+template <typename T> std::ostream& operator<<(std::ostream&, const Queue<T>&);
+
+/**
+ * A first-in first-out queue that any number of threads can enqueue to and
+ * dequeue from at once, without locks (Michael and Scott, 1996).
+ * 
+ * The queue is a singly linked list of nodes laid out as in
+ * pointerLinkedList.h, which always starts with a dummy node: _head points
+ * to the dummy, whose successor holds the front of the queue, and _tail
+ * points to the last node or, briefly, the one before it. Enqueue links a
+ * node after the last one with a compare-and-swap and then swings _tail;
+ * dequeue swings _head onto the dummy's successor, which becomes the new
+ * dummy. A thread that finds _tail lagging swings it forward itself, so no
+ * thread ever waits on another.
+ * 
+ * Unlinked nodes are reclaimed through hazardPointers.h, so a node is never
+ * deleted while another thread may still read it, and node addresses are
+ * not reused under a pending compare-and-swap (no ABA problem).
+ */
+template <class T>
+class Queue {
+   private:
+      class Node {
+         public:
+            // raw storage, since the dummy node holds no element
+            alignas(T) unsigned char data[sizeof(T)];
+            std::atomic<Node *> next;
+            
+            T * item() { return reinterpret_cast<T *>(data); }
+      };
+   public:
+      Queue();
+      
+      ~Queue();
+      
+      bool isEmpty() const;
+      bool enqueue(const T&);
+      bool enqueue(T&&);
+      bool dequeue(T&);
+      
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const Queue<T>&);
+   private:
+      // the ends are on separate cache lines, so producers swinging _tail do
+      // not slow down consumers swinging _head
+      alignas(CACHE_LINE_SIZE) std::atomic<Node *> _head;
+      alignas(CACHE_LINE_SIZE) std::atomic<Node *> _tail;
+      
+      bool link(Node *);
+      
+      Queue(const Queue&);
+      const Queue& operator=(const Queue&);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct an empty queue
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty queue, holding only the dummy node.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+Queue<T>::Queue() {
+   Node * dummy = new Node;
+   dummy->next.store(0);
+   
+   _head.store(dummy);
+   _tail.store(dummy);
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a queue object
+ * 
+ * Precondition: The life of the object is over; no other thread is using
+ *    the queue.
+ * Postcondition: The remaining elements have been destroyed and the nodes
+ *    still linked have been returned to the heap. Nodes retired earlier are
+ *    deleted by the hazard pointer scans.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+Queue<T>::~Queue() {
+   Node * dummy = _head.load();
+   Node * current = dummy->next.load();
+   delete dummy;
+   
+   while (current != 0) {
+      Node * next = current->next.load();
+      current->item()->~T();
+      delete current;
+      current = next;
+   }
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Check if a queue is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if the queue was empty at some moment during
+ *    the call and false otherwise. Other threads may have changed it since.
+ *    If the calling thread could not get hazard pointers (more than
+ *    MAX_HAZARD_THREADS threads are using them), true is returned as well,
+ *    since dequeue fails on that thread just as on an empty queue; a loop
+ *    that dequeues until the queue looks empty therefore ends.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool Queue<T>::isEmpty() const {
+   std::atomic<void *> * hazards = HazardPointers::acquire();
+   if (hazards == 0) {
+      return true;
+   }
+   
+   Node * head = HazardPointers::protect(hazards[0], _head);
+   bool empty = head->next.load() == 0;
+   hazards[0].store(0);
+   
+   return empty;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Add an item to the back of the queue
+ * 
+ * Preconditions: item is the value to be added
+ * Postcondition: item has been added after every item whose enqueue
+ *    finished before this one started. Returns false, leaving the queue
+ *    unchanged, if the calling thread could not get hazard pointers (more
+ *    than MAX_HAZARD_THREADS threads are using them).
+ * 
+ * Worst-case Time Complexity: O(1) without contention; lock-free under it
+ */
+template <class T>
+bool Queue<T>::enqueue(const T& item) {
+   if (HazardPointers::acquire() == 0) {
+      return false;
+   }
+   
+   Node * node = new Node;
+   new (node->item()) T(item);
+   node->next.store(0);
+   
+   return link(node);
+}
+
+/**
+ * Move an item to the back of the queue
+ * 
+ * Preconditions: item is the value to be added
+ * Postcondition: item has been moved to the back of the queue, as for
+ *    enqueue(const T&). Returns false, leaving item and the queue unchanged,
+ *    if the calling thread could not get hazard pointers.
+ * 
+ * Worst-case Time Complexity: O(1) without contention; lock-free under it
+ */
+template <class T>
+bool Queue<T>::enqueue(T&& item) {
+   if (HazardPointers::acquire() == 0) {
+      return false;
+   }
+   
+   Node * node = new Node;
+   new (node->item()) T(std::move(item));
+   node->next.store(0);
+   
+   return link(node);
+}
+
+/**
+ * Remove the item at the front of the queue
+ * 
+ * Preconditions: N/A
+ * Postcondition: The front item has been moved into item and removed.
+ *    Returns false, leaving item unchanged, if the queue is empty or the
+ *    calling thread could not get hazard pointers.
+ * 
+ * Worst-case Time Complexity: O(1) without contention; lock-free under it
+ */
+template <class T>
+bool Queue<T>::dequeue(T& item) {
+   std::atomic<void *> * hazards = HazardPointers::acquire();
+   if (hazards == 0) {
+      return false;
+   }
+   
+   while (true) {
+      Node * head = HazardPointers::protect(hazards[0], _head);
+      Node * tail = _tail.load();
+      Node * next = head->next.load();
+      
+      // next is safe to read once it is protected and head is still the
+      // dummy, since it cannot be retired before head is
+      hazards[1].store(next);
+      if (head != _head.load()) {
+         continue;
+      }
+      
+      if (next == 0) {
+         hazards[0].store(0);
+         hazards[1].store(0);
+         
+         return false;
+      }
+      
+      if (head == tail) {
+         // an enqueue has linked next but not yet swung _tail
+         _tail.compare_exchange_strong(tail, next);
+         continue;
+      }
+      
+      if (_head.compare_exchange_strong(head, next)) {
+         // next is the dummy now, and only this thread touches its element
+         item = std::move(*next->item());
+         next->item()->~T();
+         
+         hazards[0].store(0);
+         hazards[1].store(0);
+         
+         HazardPointers::retire(head);
+         
+         return true;
+      }
+   }
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Output the queue, front first
+ * 
+ * Precondition: The ostream, out, is open; no other thread is changing the
+ *    queue; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The queue represented by this Queue object has been
+ *    inserted into out through a ListWriter (see listWriter.h). Given a
+ *    limit, only the first limit elements are shown, followed by "..." if
+ *    there are more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T>
+void Queue<T>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit, true);
+   for (Node * current=_head.load()->next.load(); current!=0;
+        current=current->next.load()) {
+      if (!writer.add(*current->item())) {
+         break;
+      }
+   }
+   writer.finish();
+}
+
+/**
+ * Output operator for a queue object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The queue represented by the queue object has been inserted
+ *    into out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T>
+std::ostream& operator<<(std::ostream& out, const Queue<T>& queue) {
+   queue.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Link a node after the last node of the queue
+ * 
+ * Precondition: node holds a constructed element and a null next; the
+ *    calling thread has hazard pointers
+ * Postcondition: node is the last node of the queue and _tail has been
+ *    swung to it, unless another thread already moved _tail further.
+ * 
+ * Worst-Case Time Complexity: O(1) without contention; lock-free under it
+ */
+template <class T>
+bool Queue<T>::link(Node * node) {
+   std::atomic<void *> * hazards = HazardPointers::acquire();
+   
+   while (true) {
+      Node * tail = HazardPointers::protect(hazards[0], _tail);
+      Node * next = tail->next.load();
+      
+      if (tail != _tail.load()) {
+         continue;
+      }
+      
+      if (next != 0) {
+         // another enqueue has linked a node but not yet swung _tail
+         _tail.compare_exchange_strong(tail, next);
+         continue;
+      }
+      
+      Node * last = 0;
+      if (tail->next.compare_exchange_strong(last, node)) {
+         _tail.compare_exchange_strong(tail, node);
+         hazards[0].store(0);
+         
+         return true;
+      }
+   }
+}
+
+#endif /*LOCK_FREE_QUEUE_H_*/
@@ -1,17 +1,37 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
+#include <functional>
+#include <sstream>
 #include <string>
 
 // #include "arrayList.h"
 // #include "dynamicArrayList.h"
+// #include "smallArrayList.h"
+// #include "gapBufferList.h"
+// #include "circularArrayList.h"
 #include "pointerLinkedList.h"
 // #include "arrayLinkedList.h"
 // #include "pointerLinkedListWithHead.h"
+// #include "unrolledLinkedList.h"
+// #include "doublyLinkedList.h"
+// #include "indexedList.h"
+#include "concurrentList.h"
+
+// the unrolled, doubly linked and indexed lists cannot sort
+#if !defined(UNROLLED_LINKED_LIST_H_) && !defined(DOUBLY_LINKED_LIST_H_) && \
+    !defined(INDEXED_LIST_H_)
+#define TEST_SORT
+#endif
 
 void testListClass();
+void testConcurrentList();
+template <class L, class Compare>
+bool isSorted(const L&, Compare);
 
 const int LARGE_LIST_SIZE = 1024;
+const int SHARDED_LIST_SIZE = 1000;
+const int SHARD_COUNT = 8;
 
 using namespace std;
 
@@ -19,6 +39,7 @@ int main() {
    srand(time(NULL));
    
    testListClass();
+   testConcurrentList();
    
    cout << "finished" << endl;
    
@@ -123,4 +144,88 @@ void testListClass() {
    } else {
       cout << "insertion failed!" << endl;
    }
+   cout << endl;
+   
+#ifdef TEST_SORT
+   // test the sort function, on a list with duplicates
+   List<int> sortList;
+   for (int i=0; i<2*testSize; ++i) {
+      sortList.insert(rand()%testSize, i);
+   }
+   cout << "Unsorted list: " << sortList << endl;
+   
+   sortList.sort();
+   cout << "Sorted list: " << sortList << endl;
+   cout << "Sorted correctly? "
+        << (isSorted(sortList, less<int>()) ? "Yes" : "No") << endl;
+   
+   // test the sort function with a comparator
+   sortList.sort(greater<int>());
+   cout << "Sorted in descending order: " << sortList << endl;
+   cout << "Sorted correctly? "
+        << (isSorted(sortList, greater<int>()) ? "Yes" : "No") << endl;
+   
+   cout << "Size after sorting: " << sortList.getSize() << endl;
+#endif
+}
+
+/**
+ * Check that a list is in order
+ * 
+ * Precondition: L is a list of int with operator<<; compare is a strict
+ *    weak ordering of int
+ * Postcondition: Return true if no element of list comes before the element
+ *    in front of it under compare, and false otherwise
+ */
+template <class L, class Compare>
+bool isSorted(const L& list, Compare compare) {
+   // read the elements back from the list's output, so any variant will do
+   stringstream text;
+   text << list;
+   
+   int previous = 0;
+   int item = 0;
+   for (int i=0; text >> item; ++i) {
+      if (i > 0 && compare(item, previous)) {
+         return false;
+      }
+      previous = item;
+   }
+   
+   return true;
+}
+
+void testConcurrentList() {
+   // append to a sharded list, which must spread the elements over its
+   // segments rather than pile them into the last one
+   cout << "Appending " << SHARDED_LIST_SIZE << " integers to a list with "
+        << SHARD_COUNT << " segments." << endl;
+   ConcurrentList<int, List<int> > shardedList(SHARD_COUNT);
+   for (int i=0; i<SHARDED_LIST_SIZE; ++i) {
+      shardedList.insert(i, i);
+   }
+   cout << "Size: " << shardedList.getSize() << endl;
+   
+   int largest = SHARDED_LIST_SIZE/SHARD_COUNT*2;
+   if (largest < MIN_SPLIT_SIZE) {
+      largest = MIN_SPLIT_SIZE;
+   }
+   bool balanced = true;
+   cout << "Segment sizes:";
+   for (int i=0; i<shardedList.getShardCount(); ++i) {
+      cout << " " << shardedList.getShardSize(i);
+      if (shardedList.getShardSize(i) > largest) {
+         balanced = false;
+      }
+   }
+   cout << endl;
+   cout << "No segment over " << largest << "? "
+        << (balanced ? "Yes" : "No") << endl;
+   
+   // moving elements between segments must keep them in order
+   cout << "In order? " << (isSorted(shardedList, less<int>()) ? "Yes" : "No")
+        << endl;
+   cout << "First elements: ";
+   shardedList.display(cout, 10);
+   cout << endl;
 }
@@ -0,0 +1,333 @@
+#ifndef MAPPED_LIST_H_
+#define MAPPED_LIST_H_
+
+#include <cstddef>
+#include <iostream>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "arraySearch.h"
+#include "listFile.h"
+#include "listWriter.h"
+
+template <typename T> class MappedList;
+template <typename T>
+std::ostream& operator<<(std::ostream&, const MappedList<T>&);
+
+/**
+ * A read-only view of a list file, as written by the write members of
+ * dynamicArrayList.h and arrayLinkedList.h (see listFile.h).
+ * 
+ * open maps the file into memory and uses its elements where they lie:
+ * nothing is read or copied up front, so opening a list of any size takes
+ * O(1), and the operating system pages elements in as they are used and can
+ * drop them again under memory pressure. The mapping is shared with the page
+ * cache, so many processes can view the same file at the cost of one copy.
+ * 
+ * POSIX only (mmap). The file must not be truncated while it is open.
+ */
+template <class T>
+class MappedList {
+   static_assert(std::is_trivially_copyable<T>::value,
+                 "list files hold trivially copyable elements only");
+   static_assert(alignof(T) <= sizeof(ListFileHeader),
+                 "elements of a mapped list file would be misaligned");
+   public:
+      MappedList();
+      MappedList(const MappedList&) = delete;
+      
+      ~MappedList();
+      
+      int getSize() const;
+      
+      bool isEmpty() const;
+      bool isOpen() const;
+      
+      int indexOf(const T&) const;
+      int count(const T&) const;
+      bool contains(const T&) const;
+      
+      bool open(const char *);
+      void close();
+      
+      const T& operator[](const int&) const;
+      
+      const MappedList& operator=(const MappedList&) = delete;
+      
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const MappedList&);
+   private:
+      void * _mapping; // the whole file, or 0 when no file is open
+      std::size_t _length; // the length of the file in bytes
+      
+      const T * _items; // the elements, just past the header in the mapping
+      int _size;
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty list with no file open is created.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+MappedList<T>::MappedList() {
+   _mapping = 0;
+   _length = 0;
+   _items = 0;
+   _size = 0;
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The file, if one is open, has been unmapped.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+MappedList<T>::~MappedList() {
+   close();
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements in the open file, or 0 if no file
+ *    is open, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+int MappedList<T>::getSize() const {
+   return _size;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool MappedList<T>::isEmpty() const {
+   return _size==0;
+}
+
+/**
+ * Check if a file is open
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if the list is viewing a file and false
+ *    otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool MappedList<T>::isOpen() const {
+   return _mapping!=0;
+}
+
+/**
+ * Find the first occurrence of an item
+ * 
+ * Precondition: N/A
+ * Postcondition: The position of the first element equal to item is
+ *    returned, or -1 if there is none. Arithmetic elements are compared a
+ *    vector at a time (see arraySearch.h).
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+int MappedList<T>::indexOf(const T& item) const {
+   return findItem(_items, _size, item);
+}
+
+/**
+ * Count the occurrences of an item
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements equal to item is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+int MappedList<T>::count(const T& item) const {
+   return countItems(_items, _size, item);
+}
+
+/**
+ * Check if the list holds an item
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if an element equal to item is in the list and
+ *    false otherwise
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T>
+bool MappedList<T>::contains(const T& item) const {
+   return findItem(_items, _size, item) >= 0;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * View a list file
+ * 
+ * Precondition: path names a file
+ * Postcondition: If path is a list file of T elements, it has been mapped
+ *    read-only into memory, the list holds its elements and true is
+ *    returned. Otherwise false is returned and no file is open. Any file
+ *    open before has been closed either way.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool MappedList<T>::open(const char * path) {
+   close();
+   
+   int file = ::open(path, O_RDONLY);
+   if (file < 0) {
+      return false;
+   }
+   
+   struct stat status;
+   if (fstat(file, &status)!=0 ||
+       static_cast<std::size_t>(status.st_size) < sizeof(ListFileHeader)) {
+      ::close(file);
+      return false;
+   }
+   
+   std::size_t length = static_cast<std::size_t>(status.st_size);
+   void * mapping = mmap(0, length, PROT_READ, MAP_SHARED, file, 0);
+   
+   // the mapping keeps the file open by itself
+   ::close(file);
+   
+   if (mapping == MAP_FAILED) {
+      return false;
+   }
+   
+   const ListFileHeader * header = static_cast<const ListFileHeader *>(mapping);
+   if (!checkListFileHeader<T>(*header) ||
+       (length-sizeof(ListFileHeader))/sizeof(T) < header->count) {
+      munmap(mapping, length);
+      return false;
+   }
+   
+   _mapping = mapping;
+   _length = length;
+   _items = reinterpret_cast<const T *>(header+1);
+   _size = static_cast<int>(header->count);
+   
+   return true;
+}
+
+/**
+ * Stop viewing the open file
+ * 
+ * Precondition: N/A
+ * Postcondition: The file, if one was open, has been unmapped, and the list
+ *    is empty. References to its elements are no longer valid.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+void MappedList<T>::close() {
+   if (_mapping != 0) {
+      munmap(_mapping, _length);
+   }
+   
+   _mapping = 0;
+   _length = 0;
+   _items = 0;
+   _size = 0;
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Access the element at the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A const reference to the element at position, in the
+ *    mapped file, is returned. It stays valid until the file is closed.
+ * 
+ * Worst-Case Time Complexity: O(1), plus a page fault the first time its
+ *    page is touched
+ */
+template <class T>
+const T& MappedList<T>::operator[](const int& position) const {
+   return _items[position];
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this MappedList object has been
+ *    inserted into out through a ListWriter (see listWriter.h). Given a
+ *    limit, only the first limit elements are shown, followed by "..." if
+ *    there are more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T>
+void MappedList<T>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit);
+   for (int i=0; i<_size; ++i) {
+      if (!writer.add(_items[i])) {
+         break;
+      }
+   }
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T>
+std::ostream& operator<<(std::ostream& out, const MappedList<T>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+#endif /*MAPPED_LIST_H_*/
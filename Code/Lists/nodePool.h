@@ -0,0 +1,194 @@
+#ifndef NODE_POOL_H_
+#define NODE_POOL_H_
+
+#include <cassert>
+#include <new>
+
+const int MIN_CHUNK_SIZE = 16; // nodes in the first chunk a pool allocates
+const int MAX_CHUNK_SIZE = 4096; // chunks stop doubling at this many nodes
+
+/**
+ * A slab allocator for the nodes of a single linked list.
+ * 
+ * Nodes are carved out of contiguous chunks that double in size (from
+ * MIN_CHUNK_SIZE up to MAX_CHUNK_SIZE nodes). Freed nodes go onto a free list
+ * and are handed out again before any new chunk is allocated. Nothing is
+ * returned to the heap until releaseAll (or the destructor), which frees
+ * whole chunks at once.
+ * 
+ * allocate and deallocate deal in raw memory; the list constructs and
+ * destroys the Node objects itself.
+ */
+template <class Node>
+class NodePool {
+   public:
+      // the pool frees its nodes in bulk, so a list need not deallocate
+      // them one at a time before calling releaseAll
+      static const bool BULK_RELEASE = true;
+      
+      NodePool();
+      
+      ~NodePool();
+      
+      Node * allocate();
+      void deallocate(Node *);
+      void releaseAll();
+   private:
+      // a slot holds either a node or, while it is free, the link to the
+      // next free slot
+      union Slot {
+         Slot * next;
+         alignas(Node) unsigned char storage[sizeof(Node)];
+      };
+      
+      // slot 0 of each chunk links to the previously allocated chunk
+      Slot * _chunks;
+      Slot * _freeSlots; // first slot of the free list
+      
+      // slots of the newest chunk that have never been handed out
+      Slot * _nextUnused;
+      Slot * _chunkEnd;
+      
+      int _nextChunkSize;
+      
+      NodePool(const NodePool&);
+      const NodePool& operator=(const NodePool&);
+};
+
+/**
+ * An allocator with the NodePool interface that gets every node straight
+ * from the heap, as the lists did before pooling. Useful for comparison.
+ */
+template <class Node>
+class HeapNodeAllocator {
+   public:
+      static const bool BULK_RELEASE = false;
+      
+      Node * allocate() {
+         return static_cast<Node *>(::operator new(sizeof(Node)));
+      }
+      void deallocate(Node * node) { ::operator delete(node); }
+      void releaseAll() {}
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct an empty pool
+ * 
+ * Precondition: N/A
+ * Postcondition: A pool with no chunks allocated is created.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class Node>
+NodePool<Node>::NodePool() {
+   _chunks = 0;
+   _freeSlots = 0;
+   _nextUnused = 0;
+   _chunkEnd = 0;
+   _nextChunkSize = MIN_CHUNK_SIZE;
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a pool
+ * 
+ * Precondition: No node handed out by the pool is still in use.
+ * Postcondition: Every chunk has been returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(number of chunks)
+ */
+template <class Node>
+NodePool<Node>::~NodePool() {
+   releaseAll();
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get memory for one node
+ * 
+ * Precondition: N/A
+ * Postcondition: A pointer to uninitialized memory suitable for a Node is
+ *    returned. A recycled slot is preferred; a new chunk is allocated only
+ *    when every slot is in use.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class Node>
+Node * NodePool<Node>::allocate() {
+   Slot * slot;
+   
+   if (_freeSlots != 0) {
+      slot = _freeSlots;
+      _freeSlots = _freeSlots->next;
+   } else {
+      if (_nextUnused == _chunkEnd) {
+         Slot * chunk = new(std::nothrow) Slot[_nextChunkSize+1];
+         assert(chunk != 0);
+         
+         chunk[0].next = _chunks;
+         _chunks = chunk;
+         
+         _nextUnused = chunk+1;
+         _chunkEnd = chunk+1+_nextChunkSize;
+         
+         if (_nextChunkSize < MAX_CHUNK_SIZE) {
+            _nextChunkSize *= 2;
+         }
+      }
+      
+      slot = _nextUnused;
+      ++_nextUnused;
+   }
+   
+   return reinterpret_cast<Node *>(slot->storage);
+}
+
+/**
+ * Return the memory for one node to the pool
+ * 
+ * Precondition: node was handed out by this pool and has been destroyed
+ * Postcondition: The memory is on the free list, ready to be reused.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class Node>
+void NodePool<Node>::deallocate(Node * node) {
+   Slot * slot = reinterpret_cast<Slot *>(node);
+   slot->next = _freeSlots;
+   _freeSlots = slot;
+}
+
+/**
+ * Return every chunk to the heap
+ * 
+ * Precondition: Every node handed out by the pool has been destroyed (or has
+ *    a trivial destructor) and will not be used again.
+ * Postcondition: The pool is empty, as if newly constructed.
+ * 
+ * Worst-Case Time Complexity: O(number of chunks)
+ */
+template <class Node>
+void NodePool<Node>::releaseAll() {
+   while (_chunks != 0) {
+      Slot * chunk = _chunks;
+      _chunks = _chunks[0].next;
+      delete [] chunk;
+   }
+   
+   _freeSlots = 0;
+   _nextUnused = 0;
+   _chunkEnd = 0;
+   _nextChunkSize = MIN_CHUNK_SIZE;
+}
+
+#endif /*NODE_POOL_H_*/
@@ -0,0 +1,102 @@
+#ifndef NODE_SORT_H_
+#define NODE_SORT_H_
+
+/*
+ * Merge sort for singly linked lists of nodes with data and next members.
+ * 
+ * sortNodes works bottom up: it merges neighbouring runs of 1 node, then of
+ * 2, 4, ... until one run is left, relinking the nodes as it goes. No
+ * element is copied or moved, so pointers and iterators to the elements stay
+ * valid, and the sort needs O(1) extra memory. Equal elements keep their
+ * order.
+ */
+
+/**
+ * Cut a run of nodes off the front of a chain
+ * 
+ * Precondition: first is the first node of a chain, or 0; length > 0
+ * Postcondition: The chain has been cut after its first length nodes (or
+ *    left whole if it is shorter), and the first node after the cut, or 0,
+ *    is returned.
+ * 
+ * Worst-Case Time Complexity: O(length)
+ */
+template <class Node>
+Node * splitNodes(Node * first, const int& length) {
+   for (int i=1; first!=0 && i<length; ++i) {
+      first = first->next;
+   }
+   
+   if (first == 0) {
+      return 0;
+   }
+   
+   Node * rest = first->next;
+   first->next = 0;
+   
+   return rest;
+}
+
+/**
+ * Merge two sorted chains of nodes
+ * 
+ * Precondition: left and right are chains sorted by compare, either may be 0;
+ *    link is where the merged chain is to be linked
+ * Postcondition: *link is the first node of the merged chain, in which nodes
+ *    from left come before equal ones from right. The link field of its last
+ *    node is returned.
+ * 
+ * Worst-Case Time Complexity: O(length of left + length of right)
+ */
+template <class Node, class Compare>
+Node ** mergeNodes(Node * left, Node * right, Node ** link,
+                   Compare& compare) {
+   while (left!=0 && right!=0) {
+      if (compare(right->data, left->data)) {
+         *link = right;
+         right = right->next;
+      } else {
+         *link = left;
+         left = left->next;
+      }
+      link = &(*link)->next;
+   }
+   
+   *link = (left != 0 ? left : right);
+   while (*link != 0) {
+      link = &(*link)->next;
+   }
+   
+   return link;
+}
+
+/**
+ * Sort a chain of nodes
+ * 
+ * Precondition: first is the first of count nodes, the last of which has a
+ *    next of 0; compare is a strict weak ordering on their data
+ * Postcondition: The nodes have been relinked in order by compare, and the
+ *    new first node is returned.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class Node, class Compare>
+Node * sortNodes(Node * first, const int& count, Compare compare) {
+   for (int length=1; length<count; length*=2) {
+      Node * rest = first;
+      Node ** link = &first;
+      
+      // merge each pair of runs of length nodes onto the end of the chain
+      while (rest != 0) {
+         Node * left = rest;
+         Node * right = splitNodes(left, length);
+         rest = splitNodes(right, length);
+         
+         link = mergeNodes(left, right, link, compare);
+      }
+   }
+   
+   return first;
+}
+
+#endif /*NODE_SORT_H_*/
@@ -0,0 +1,646 @@
+#ifndef PERSISTENT_LIST_H_
+#define PERSISTENT_LIST_H_
+
+#include <atomic>
+#include <iostream>
+
+#include "listWriter.h"
+
+template <typename T> class PersistentList;
+template <typename T>
+std::ostream& operator<<(std::ostream&, const PersistentList<T>&);
+
+/**
+ * An immutable list. Nothing ever changes a PersistentList once it has been
+ * built: insert and remove return a new version of the list and leave the
+ * original as it was, so every version stays valid for as long as it is
+ * kept, as undo histories and snapshots need.
+ * 
+ * The list is a treap laid out as in indexedList.h, whose nodes are shared
+ * between versions and reference counted. A new version copies only the
+ * nodes on the paths its splits and merges walk, O(log n) of them expected,
+ * and points at the rest of the old tree; nodes are deleted when the last
+ * version holding them goes. k versions of an n-element list built one edit
+ * at a time therefore take O(n + k log n) memory, where deep copies made by
+ * copyList in pointerLinkedList.h take O(kn). Copying a version is O(1).
+ * 
+ * The reference counts are atomic, so different versions, even versions
+ * sharing nodes, can be used and destroyed by different threads at once.
+ */
+template <class T>
+class PersistentList {
+   private:
+      class Node {
+         public:
+            T data;
+            Node * left;
+            Node * right;
+            int size; // the number of nodes in the subtree rooted here
+            unsigned int priority;
+            
+            // the number of versions and parent nodes pointing here
+            std::atomic<int> references;
+      };
+   public:
+      PersistentList();
+      PersistentList(const PersistentList&);
+      
+      ~PersistentList();
+      
+      int getSize() const;
+      int getCapacity() const;
+      
+      bool isEmpty() const;
+      PersistentList insert(const T&, const int&) const;
+      PersistentList remove(const int&) const;
+      
+      template <class Iterator>
+      PersistentList insertRange(Iterator, Iterator, const int&) const;
+      PersistentList removeRange(const int&, const int&) const;
+      
+      const T& operator[](const int&) const;
+      
+      const PersistentList& operator=(const PersistentList&);
+      
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const PersistentList&);
+   private:
+      Node * _root; // root of the tree, 0 when the list is empty
+      
+      // state of the generator that draws node priorities; each version
+      // passes it on to the versions made from it
+      unsigned int _random;
+      
+      PersistentList(Node *, const unsigned int&);
+      
+      static int sizeOf(const Node *);
+      static void update(Node *);
+      static void split(Node *, int, Node * &, Node * &);
+      static Node * merge(Node *, Node *);
+      static bool displayTree(const Node *, ListWriter&);
+      
+      static Node * createNode(const T&, unsigned int&);
+      static Node * retain(Node *);
+      static void release(Node *);
+      static Node * own(Node *);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty list, with size 0, is created.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+PersistentList<T>::PersistentList() {
+   _root = 0;
+   _random = 2463534242u;
+}
+
+/**
+ * Construct a copy of a PersistentList object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A list sharing every node of originalList has been
+ *    constructed.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+PersistentList<T>::PersistentList(const PersistentList& originalList) {
+   _root = retain(originalList._root);
+   _random = originalList._random;
+}
+
+/**
+ * Construct a version around a tree
+ * 
+ * Precondition: root is a tree, or 0, whose reference is handed over to the
+ *    new list; random is the generator state to carry on with
+ * Postcondition: A list holding the tree has been constructed.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+PersistentList<T>::PersistentList(Node * root, const unsigned int& random) {
+   _root = root;
+   _random = random;
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The nodes no other version holds have been returned to the
+ *    heap.
+ * 
+ * Worst-Case Time Complexity: O(number of nodes only this version holds)
+ */
+template <class T>
+PersistentList<T>::~PersistentList() {
+   release(_root);
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+int PersistentList<T>::getSize() const {
+   return sizeOf(_root);
+}
+
+/**
+ * Get the capacity of a list object.
+ * 
+ * Note that this function is only provided for compatability with other list
+ * implementations.
+ * 
+ * Precondition: N/A
+ * Postcondition: -1 is returned since a pointer based tree has no predefined
+ *    capacity
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+int PersistentList<T>::getCapacity() const {
+   return -1;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+bool PersistentList<T>::isEmpty() const {
+   return _root==0;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Make a version of the list with an item inserted at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: A version of the list with item at the specified position
+ *    is returned; this list is unchanged. If position is not acceptable, the
+ *    version returned is a copy of this list.
+ * 
+ * Worst-case Time Complexity: O(log n) expected
+ */
+template <class T>
+PersistentList<T> PersistentList<T>::insert(const T& item,
+                                            const int& position) const {
+   // verify that this is an acceptable position
+   if (position<0 || position>getSize()) {
+      return *this;
+   }
+   
+   unsigned int random = _random;
+   
+   // split off the elements before position and put the new one between
+   Node * before;
+   Node * after;
+   split(retain(_root), position, before, after);
+   
+   Node * root = merge(merge(before, createNode(item, random)), after);
+   
+   return PersistentList(root, random);
+}
+
+/**
+ * Make a version of the list with the item at the specified position removed
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: A version of the list without the element at the
+ *    specified position is returned; this list is unchanged. If position is
+ *    not valid, the version returned is a copy of this list.
+ * 
+ * Worst-Case Time Complexity: O(log n) expected
+ */
+template <class T>
+PersistentList<T> PersistentList<T>::remove(const int& position) const {
+   // verify this is a valid item to delete
+   if (position<0 || position>=getSize()) {
+      return *this;
+   }
+   
+   return removeRange(position, position+1);
+}
+
+/**
+ * Make a version of the list with the items in [first, last) inserted,
+ * starting at the specified position
+ * 
+ * Preconditions: first and last are input iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: A version of the list with the items inserted, in order, so
+ *    that *first is at the specified position is returned; this list is
+ *    unchanged. If position is not acceptable, the version returned is a copy
+ *    of this list.
+ * 
+ * Worst-case Time Complexity: O(k log k + log n) expected, k being the
+ *    number of items inserted
+ */
+template <class T>
+template <class Iterator>
+PersistentList<T> PersistentList<T>::insertRange(Iterator first,
+                                                 Iterator last,
+                                                 const int& position) const {
+   // verify that this is an acceptable position
+   if (position<0 || position>getSize()) {
+      return *this;
+   }
+   
+   unsigned int random = _random;
+   
+   // build the new items into a tree of their own
+   Node * items = 0;
+   for (; first!=last; ++first) {
+      items = merge(items, createNode(*first, random));
+   }
+   
+   Node * before;
+   Node * after;
+   split(retain(_root), position, before, after);
+   
+   Node * root = merge(merge(before, items), after);
+   
+   return PersistentList(root, random);
+}
+
+/**
+ * Make a version of the list with the items at positions from through to-1
+ * removed
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: A version of the list without the elements in [from, to)
+ *    is returned; this list is unchanged. If the range is not valid, the
+ *    version returned is a copy of this list.
+ * 
+ * Worst-Case Time Complexity: O(log n) expected, plus the nodes in the range
+ *    that no other version holds
+ */
+template <class T>
+PersistentList<T> PersistentList<T>::removeRange(const int& from,
+                                                 const int& to) const {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>getSize() || from==to) {
+      return *this;
+   }
+   
+   Node * before;
+   Node * range;
+   Node * after;
+   split(retain(_root), from, before, range);
+   split(range, to-from, range, after);
+   
+   release(range);
+   
+   return PersistentList(merge(before, after), _random);
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Access the element at the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A const reference to the element at position is returned.
+ *    It stays valid for as long as any version holding the element does.
+ * 
+ * Worst-Case Time Complexity: O(log n) expected
+ */
+template <class T>
+const T& PersistentList<T>::operator[](const int& position) const {
+   const Node * ptr = _root;
+   int index = position;
+   
+   // the left subtree holds the positions before this node
+   while (index != sizeOf(ptr->left)) {
+      if (index < sizeOf(ptr->left)) {
+         ptr = ptr->left;
+      } else {
+         index -= sizeOf(ptr->left)+1;
+         ptr = ptr->right;
+      }
+   }
+   
+   return ptr->data;
+}
+
+/**
+ * Assign a version of a list to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: This list shares every node of rhs, and the nodes only it
+ *    held before have been returned to the heap. A const reference to this
+ *    list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1), plus the nodes only this list held
+ */
+template <class T>
+const PersistentList<T>&
+PersistentList<T>::operator=(const PersistentList& rhs) {
+   // take the new reference first, in case both lists hold the same tree
+   Node * root = retain(rhs._root);
+   release(_root);
+   
+   _root = root;
+   _random = rhs._random;
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this PersistentList object has been
+ *    inserted into out through a ListWriter (see listWriter.h). Given a
+ *    limit, only the first limit elements are shown, followed by "..." if
+ *    there are more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit + log n) expected given a limit
+ */
+template <class T>
+void PersistentList<T>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit, true);
+   displayTree(_root, writer);
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T>
+std::ostream& operator<<(std::ostream& out, const PersistentList<T>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a subtree
+ * 
+ * Precondition: node is the root of a subtree, or 0
+ * Postcondition: The number of nodes in the subtree is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+int PersistentList<T>::sizeOf(const Node * node) {
+   return node == 0 ? 0 : node->size;
+}
+
+/**
+ * Recompute the size of a node from its children
+ * 
+ * Precondition: node is not 0; the sizes of its children are correct
+ * Postcondition: node->size is correct.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+void PersistentList<T>::update(Node * node) {
+   node->size = sizeOf(node->left)+1+sizeOf(node->right);
+}
+
+/**
+ * Split a tree in two at a position
+ * 
+ * Precondition: 0 <= position <= size of the tree rooted at node; the caller
+ *    hands over its reference to node
+ * Postcondition: before holds the first position elements and after holds
+ *    the rest, both as valid treaps the caller holds a reference to. Nodes
+ *    on the split path that other versions share have been copied rather
+ *    than changed.
+ * 
+ * Worst-Case Time Complexity: O(depth of the tree)
+ */
+template <class T>
+void PersistentList<T>::split(Node * node, int position, Node * &before,
+                              Node * &after) {
+   // splitting at either end changes nothing, so nothing need be copied
+   if (position == 0) {
+      before = 0;
+      after = node;
+      return;
+   }
+   if (position == sizeOf(node)) {
+      before = node;
+      after = 0;
+      return;
+   }
+   
+   node = own(node);
+   
+   if (position <= sizeOf(node->left)) {
+      // node and its right subtree come after the split
+      split(node->left, position, before, node->left);
+      after = node;
+   } else {
+      // node and its left subtree come before the split
+      split(node->right, position-sizeOf(node->left)-1, node->right, after);
+      before = node;
+   }
+   
+   update(node);
+}
+
+/**
+ * Join two trees
+ * 
+ * Precondition: before and after are valid treaps (either may be 0); the
+ *    caller hands over its references to both
+ * Postcondition: The root of a treap holding the elements of before followed
+ *    by those of after is returned, with the caller holding a reference to
+ *    it. Nodes on the merge path that other versions share have been copied
+ *    rather than changed.
+ * 
+ * Worst-Case Time Complexity: O(depth of the trees)
+ */
+template <class T>
+typename PersistentList<T>::Node * PersistentList<T>::merge(Node * before,
+                                                            Node * after) {
+   if (before == 0) {
+      return after;
+   }
+   if (after == 0) {
+      return before;
+   }
+   
+   // the root with the higher priority stays on top
+   if (before->priority > after->priority) {
+      before = own(before);
+      before->right = merge(before->right, after);
+      update(before);
+      return before;
+   }
+   
+   after = own(after);
+   after->left = merge(before, after->left);
+   update(after);
+   return after;
+}
+
+/**
+ * Add a subtree to a writer in order
+ * 
+ * Precondition: N/A
+ * Postcondition: The elements of the subtree rooted at node have been added
+ *    to writer, in list order, until it took no more. Return true if it took
+ *    all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(size of the subtree)
+ */
+template <class T>
+bool PersistentList<T>::displayTree(const Node * node, ListWriter& writer) {
+   if (node == 0) {
+      return true;
+   }
+   
+   return displayTree(node->left, writer) && writer.add(node->data) &&
+          displayTree(node->right, writer);
+}
+
+/**
+ * Create a node
+ * 
+ * Precondition: random is the state of the priority generator
+ * Postcondition: A leaf node holding a copy of item, with a fresh random
+ *    priority, is returned with the caller holding its only reference.
+ *    random has been advanced.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+typename PersistentList<T>::Node *
+PersistentList<T>::createNode(const T& item, unsigned int& random) {
+   // xorshift, which is plenty random enough to balance the tree
+   random ^= random << 13;
+   random ^= random >> 17;
+   random ^= random << 5;
+   
+   Node * node = new Node;
+   node->data = item;
+   node->left = 0;
+   node->right = 0;
+   node->size = 1;
+   node->priority = random;
+   node->references.store(1);
+   
+   return node;
+}
+
+/**
+ * Take another reference to a subtree
+ * 
+ * Precondition: node is the root of a subtree, or 0
+ * Postcondition: The subtree's reference count has been incremented and node
+ *    is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+typename PersistentList<T>::Node * PersistentList<T>::retain(Node * node) {
+   if (node != 0) {
+      node->references.fetch_add(1);
+   }
+   
+   return node;
+}
+
+/**
+ * Give up a reference to a subtree
+ * 
+ * Precondition: The caller holds a reference to node, or node is 0
+ * Postcondition: The reference has been dropped. If it was the last, the
+ *    node has been deleted and its references to its children given up.
+ * 
+ * Worst-Case Time Complexity: O(number of nodes no longer referenced)
+ */
+template <class T>
+void PersistentList<T>::release(Node * node) {
+   if (node == 0 || node->references.fetch_sub(1) != 1) {
+      return;
+   }
+   
+   release(node->left);
+   release(node->right);
+   delete node;
+}
+
+/**
+ * Get a node that can be changed in place of a possibly shared one
+ * 
+ * Precondition: The caller holds a reference to node, which is not 0
+ * Postcondition: If the caller's reference was the only one, node is
+ *    returned. Otherwise a copy sharing node's children is returned with the
+ *    caller holding its only reference, and the reference to node has been
+ *    given up.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T>
+typename PersistentList<T>::Node * PersistentList<T>::own(Node * node) {
+   // no other version can reach a node only the caller holds
+   if (node->references.load() == 1) {
+      return node;
+   }
+   
+   Node * copiedNode = new Node;
+   copiedNode->data = node->data;
+   copiedNode->left = retain(node->left);
+   copiedNode->right = retain(node->right);
+   copiedNode->size = node->size;
+   copiedNode->priority = node->priority;
+   copiedNode->references.store(1);
+   
+   release(node);
+   
+   return copiedNode;
+}
+
+#endif /*PERSISTENT_LIST_H_*/
@@ -1,13 +1,26 @@
 #ifndef POINTER_LINKED_LIST_H_
 #define POINTER_LINKED_LIST_H_
 
+#include <atomic>
+#include <functional>
 #include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
 
-template <typename T> class List;
-template <typename T> std::ostream& operator<<(std::ostream&, const List<T>&);
+#include "listStats.h"
+#include "listWriter.h"
+#include "nodePool.h"
+#include "nodeSort.h"
 
-template <class T>
-class List {
+template <typename T, template <class> class Allocator = NodePool,
+          class Stats = LIST_STATS> class List;
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Allocator, Stats>&);
+
+template <class T, template <class> class Allocator, class Stats>
+class List : private Stats {
    private:
       class Node {
          public:            
@@ -15,6 +28,79 @@ class List {
             Node * next;
       };
    public:
+      // forward iterators over the elements of the list. An iterator stays
+      // valid until the node it refers to is removed.
+      class iterator {
+         public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T * pointer;
+            typedef T & reference;
+            
+            iterator() { _node = 0; }
+            
+            reference operator*() const { return _node->data; }
+            pointer operator->() const { return &_node->data; }
+            
+            iterator& operator++() {
+               _node = _node->next;
+               return *this;
+            }
+            iterator operator++(int) {
+               iterator old = *this;
+               _node = _node->next;
+               return old;
+            }
+            
+            bool operator==(const iterator& rhs) const {
+               return _node == rhs._node;
+            }
+            bool operator!=(const iterator& rhs) const {
+               return _node != rhs._node;
+            }
+         private:
+            friend class List;
+            explicit iterator(Node * node) { _node = node; }
+            Node * _node;
+      };
+      
+      class const_iterator {
+         public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T * pointer;
+            typedef const T & reference;
+            
+            const_iterator() { _node = 0; }
+            const_iterator(const iterator& it) { _node = it._node; }
+            
+            reference operator*() const { return _node->data; }
+            pointer operator->() const { return &_node->data; }
+            
+            const_iterator& operator++() {
+               _node = _node->next;
+               return *this;
+            }
+            const_iterator operator++(int) {
+               const_iterator old = *this;
+               _node = _node->next;
+               return old;
+            }
+            
+            bool operator==(const const_iterator& rhs) const {
+               return _node == rhs._node;
+            }
+            bool operator!=(const const_iterator& rhs) const {
+               return _node != rhs._node;
+            }
+         private:
+            friend class List;
+            explicit const_iterator(const Node * node) { _node = node; }
+            const Node * _node;
+      };
+      
       List();
       List(const List&);
       
@@ -22,21 +108,83 @@ class List {
      
       int getSize() const;
       int getCapacity() const;
+      const Stats& getStats() const;
       
       bool isEmpty() const;
+      bool isShared() const;
       bool insert(const T&, const int&);
       bool remove(const int&);
       
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      void sort();
+      template <class Compare>
+      void sort(Compare);
+      
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      
+      iterator insertAfter(iterator, const T&);
+      iterator eraseAfter(iterator);
+      
+      void setCopyOnWrite(const bool&);
+      
       const List& operator=(const List&);
       
-      void display(std::ostream&) const;
-      friend std::ostream& operator<< <>(std::ostream&, const List<T>&);
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = true;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
    private:
       Node * _first; // pointer to the first element of the linked list
       int _size; // the number of elements stored in the linked list
       
+      // the node most recently reached by a positional walk, and its
+      // position. Walks to a later position resume from here instead of
+      // from _first, so scanning positions in order costs O(1) per step.
+      // _cursor is 0 when no position is remembered.
+      mutable Node * _cursor;
+      mutable int _cursorPosition;
+      
+      Node * findNode(const int&) const;
+      
+      // the nodes of this list are allocated from, and returned to, _pool
+      Allocator<Node> _pool;
+      
+      // nodes that copy-on-write copies of a list share, together with the
+      // pool they are allocated from and the number of lists sharing them
+      class Storage {
+         public:
+            Storage() { references.store(1); }
+            
+            std::atomic<int> references;
+            Allocator<Node> pool;
+      };
+      
+      // with copy-on-write on, the nodes come from _shared->pool instead of
+      // _pool, and copies share them until one of them changes; shared
+      // nodes are never changed. _shared is 0 when copy-on-write is off.
+      Storage * _shared;
+      
+      Allocator<Node>& pool();
+      
+      Node * createNode();
+      void destroyNode(Node *);
+      
       bool copyList(Node *, Node * &);
-      bool deleteList(Node *);
+      bool deleteList(Node *, Allocator<Node>&);
+      
+      bool unshare();
+      bool moveToStorage(Storage *);
+      void releaseNodes(Node *, Storage *);
+      Node * findCopiedNode(Node *);
 };
 
 /*****************************************************************************/
@@ -51,10 +199,13 @@ class List {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-List<T>::List() {
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List() {
    _first = 0;
    _size = 0;
+   _cursor = 0;
+   _cursorPosition = 0;
+   _shared = 0;
 }
 
 /**
@@ -62,15 +213,26 @@ List<T>::List() {
  * 
  * Precondition: A copy of originalList is needed. originalList is a const
  *    reference parameter
- * Postcondition: A copy of originalList has been constructed.
+ * Postcondition: A copy of originalList has been constructed. If
+ *    originalList is in copy-on-write mode, the copy shares its nodes and is
+ *    in copy-on-write mode too.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(n); O(1) in copy-on-write mode
  */
-template <class T>
-List<T>::List(const List& originalList) { 
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List(const List& originalList) { 
    // initialize an empty list
    _first = 0;
    _size = originalList._size;
+   _cursor = 0;
+   _cursorPosition = 0;
+   
+   _shared = originalList._shared;
+   if (_shared != 0) {
+      _shared->references.fetch_add(1);
+      _first = originalList._first;
+      return;
+   }
    
    // copy the original list
    copyList(originalList._first, _first);
@@ -85,13 +247,13 @@ List<T>::List(const List& originalList) {
  * 
  * Precondition: The life of the object is over.
  * Postcondition: The memory dynamically allocated by the linked list has been
- *    returned to the heap.
+ *    returned to the heap, unless other lists still share it.
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-List<T>::~List() {
-   deleteList(_first);
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::~List() {
+   releaseNodes(_first, _shared);
 }
 
 /*****************************************************************************/
@@ -106,8 +268,8 @@ List<T>::~List() {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getSize() const {
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getSize() const {
    return _size;
 }
 
@@ -123,11 +285,25 @@ int List<T>::getSize() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getCapacity() const {
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getCapacity() const {
    return -1;
 }
 
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+const Stats& List<T, Allocator, Stats>::getStats() const {
+   return *this;
+}
+
 /**
  * Check if a list is empty
  * 
@@ -136,11 +312,25 @@ int List<T>::getCapacity() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-bool List<T>::isEmpty() const {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::isEmpty() const {
    return _size==0;
 }
 
+/**
+ * Check if the list shares its nodes with a copy-on-write copy
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if another list holds the same nodes, so the
+ *    next change to either list will copy them, and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::isShared() const {
+   return _shared!=0 && _shared->references.load()>1;
+}
+
 /*****************************************************************************/
 /********************** Functions ********************************************/
 /*****************************************************************************/
@@ -154,16 +344,19 @@ bool List<T>::isEmpty() const {
  * 
  * Worst-case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::insert(const T& item, const int& position) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::insert(const T& item, const int& position) {
    // verify that this is an acceptable position
    if (position<0 || position>_size) {
       return false;
    }
    
+   unshare();
+   
    // create a new node with the specified data
-   Node * newNode = new Node;
+   Node * newNode = createNode();
    newNode->data = item;
+   this->countCopies(1);
    newNode->next = 0;
    
    // if this is the new head, then update _first
@@ -174,12 +367,12 @@ bool List<T>::insert(const T& item, const int& position) {
          newNode->next=_first;
          _first = newNode;
       }
+      
+      // every remembered node has moved one position down the list
+      ++_cursorPosition;
    } else {
       // go to the appropriate position in the linked list to insert the item
-      Node * predPtr = _first;
-      for (int i=1; i<position; ++i) {
-         predPtr = predPtr->next;
-      }
+      Node * predPtr = findNode(position-1);
       
       // insert the new element
       newNode->next = predPtr->next;
@@ -200,8 +393,8 @@ bool List<T>::insert(const T& item, const int& position) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::remove(const int& position) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::remove(const int& position) {
    // verify we can delete an element
    if (_size==0) {
       return false;
@@ -212,26 +405,30 @@ bool List<T>::remove(const int& position) {
       return false;
    }
    
+   unshare();
+   
    // the first item is a special case
    if (position==0) {
       Node * ptr = _first;
       _first = _first->next;
-      delete ptr;
+      
+      if (_cursor == ptr) {
+         _cursor = 0;
+      }
+      --_cursorPosition;
+      
+      destroyNode(ptr);
    } else {
    
       // go to the appropriate position in the linked list to delete the item
-      Node * ptr = _first;
-      Node * predPtr;
-      for (int i=0; i<position; ++i) {
-         predPtr = ptr;
-         ptr = ptr->next;
-      }
+      Node * predPtr = findNode(position-1);
+      Node * ptr = predPtr->next;
       
       // bypass the item to be deleted
       predPtr->next = ptr->next;
       
       // free the memory for the item to be deleted
-      delete ptr;
+      destroyNode(ptr);
    }
    
    --_size;
@@ -239,6 +436,305 @@ bool List<T>::remove(const int& position) {
    return true;
 }
 
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are input iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The list is walked to position only once and
+ *    the new nodes are spliced in as a single chain.
+ * 
+ * Worst-case Time Complexity: O(n+k), k being the number of items inserted
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Iterator>
+bool List<T, Allocator, Stats>::insertRange(Iterator first, Iterator last,
+                                            const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   if (first == last) {
+      return true;
+   }
+   
+   unshare();
+   
+   // build the new items into a chain of their own
+   Node * chainFirst = createNode();
+   chainFirst->data = *first;
+   this->countCopies(1);
+   chainFirst->next = 0;
+   
+   Node * chainLast = chainFirst;
+   int count = 1;
+   for (++first; first!=last; ++first) {
+      chainLast->next = createNode();
+      chainLast = chainLast->next;
+      chainLast->data = *first;
+      this->countCopies(1);
+      chainLast->next = 0;
+      ++count;
+   }
+   
+   // splice the chain in at the specified position
+   if (position==0) {
+      chainLast->next = _first;
+      _first = chainFirst;
+      _cursorPosition += count;
+   } else {
+      // go to the appropriate position in the linked list to insert the items
+      Node * predPtr = findNode(position-1);
+      
+      chainLast->next = predPtr->next;
+      predPtr->next = chainFirst;
+   }
+   
+   _size += count;
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. The list is
+ *    walked to from only once.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   if (from == to) {
+      return true;
+   }
+   
+   unshare();
+   
+   // go to the node before the first item to delete, if there is one
+   Node * predPtr = 0;
+   Node * ptr = _first;
+   if (from > 0) {
+      predPtr = findNode(from-1);
+      ptr = predPtr->next;
+   } else {
+      _cursor = 0;
+   }
+   
+   // free the memory for the items to be deleted
+   for (int i=from; i<to; ++i) {
+      Node * tempPtr = ptr;
+      ptr = ptr->next;
+      destroyNode(tempPtr);
+   }
+   this->countLinks(to-from);
+   
+   // bypass the deleted items
+   if (predPtr == 0) {
+      _first = ptr;
+   } else {
+      predPtr->next = ptr;
+   }
+   
+   _size -= to-from;
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare, equal elements in
+ *    the order they were in before. The nodes have been relinked by a
+ *    bottom-up merge sort (see nodeSort.h) and no element has moved, so
+ *    iterators still refer to the same elements, unless the nodes were
+ *    shared with a copy-on-write copy and had to be copied.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Compare>
+void List<T, Allocator, Stats>::sort(Compare compare) {
+   unshare();
+   
+   _first = sortNodes(_first, _size, compare);
+   
+   // the remembered node is at another position now
+   _cursor = 0;
+}
+
+/**
+ * Get an iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator referring to the first element is returned, or
+ *    end() if the list is empty. Elements can be changed through it, so a
+ *    list sharing its nodes with a copy-on-write copy first copies them.
+ *    Iterators obtained before the list is copied in copy-on-write mode must
+ *    not be used to change it afterwards.
+ * 
+ * Worst-Case Time Complexity: O(1); O(n) if the nodes are shared
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::begin() {
+   unshare();
+   
+   return iterator(_first);
+}
+
+/**
+ * Get an iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator that compares equal to an iterator advanced past
+ *    the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::end() {
+   return iterator(0);
+}
+
+/**
+ * Get a const iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator referring to the first element is returned,
+ *    or end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::const_iterator
+List<T, Allocator, Stats>::begin() const {
+   return const_iterator(_first);
+}
+
+/**
+ * Get a const iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator that compares equal to a const_iterator
+ *    advanced past the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::const_iterator
+List<T, Allocator, Stats>::end() const {
+   return const_iterator(0);
+}
+
+/**
+ * Insert an item directly after the element an iterator refers to
+ * 
+ * Preconditions: position refers to an element of this list (not end()). Use
+ *    insert(item, 0) to add a new first element.
+ * Postcondition: item is inserted after *position. An iterator to the new
+ *    element is returned. Existing iterators remain valid, unless the nodes
+ *    were shared with a copy-on-write copy and had to be copied.
+ * 
+ * Worst-case Time Complexity: O(1); O(n) if the nodes are shared
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::insertAfter(iterator position, const T& item) {
+   if (isShared()) {
+      position = iterator(findCopiedNode(position._node));
+   }
+   
+   Node * newNode = createNode();
+   newNode->data = item;
+   this->countCopies(1);
+   newNode->next = position._node->next;
+   position._node->next = newNode;
+   
+   // the positions of the remembered node are no longer known
+   _cursor = 0;
+   
+   ++_size;
+   
+   return iterator(newNode);
+}
+
+/**
+ * Remove the element directly after the element an iterator refers to
+ * 
+ * Preconditions: position refers to an element of this list that is not the
+ *    last element. Use remove(0) to remove the first element.
+ * Postcondition: The element after *position has been removed. An iterator to
+ *    the element that followed it is returned. Iterators to the removed
+ *    element are invalidated, as are all others if the nodes were shared
+ *    with a copy-on-write copy and had to be copied.
+ * 
+ * Worst-case Time Complexity: O(1); O(n) if the nodes are shared
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::eraseAfter(iterator position) {
+   if (isShared()) {
+      position = iterator(findCopiedNode(position._node));
+   }
+   
+   Node * ptr = position._node->next;
+   position._node->next = ptr->next;
+   destroyNode(ptr);
+   
+   // the positions of the remembered node are no longer known
+   _cursor = 0;
+   
+   --_size;
+   
+   return iterator(position._node->next);
+}
+
+/**
+ * Enable or disable copy-on-write copies
+ * 
+ * Precondition: N/A
+ * Postcondition: If copyOnWrite is true, copies of this list (by copy
+ *    construction or assignment) share its nodes in O(1), and whichever list
+ *    is changed first makes its own copy of them then. If it is false, the
+ *    list has nodes of its own and copies of it are deep copies.
+ * 
+ * Worst-Case Time Complexity: O(n), since the nodes move between _pool and
+ *    the shared storage; O(1) if the mode does not change
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::setCopyOnWrite(const bool& copyOnWrite) {
+   if (copyOnWrite && _shared==0) {
+      moveToStorage(new Storage);
+   } else if (!copyOnWrite && _shared!=0) {
+      moveToStorage(0);
+   }
+}
+
 /*****************************************************************************/
 /********************** Operators ********************************************/
 /*****************************************************************************/
@@ -248,21 +744,40 @@ bool List<T>::remove(const int& position) {
  * 
  * Preconditions: N/A
  * Postconditions: A copy of rhs has been assigned to this object. A const
- *    reference to this list is returned.
+ *    reference to this list is returned. If rhs is in copy-on-write mode,
+ *    this list now shares its nodes and is in copy-on-write mode too.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(n); O(1) plus releasing the previous nodes
+ *    in copy-on-write mode
  */
-template <class T>
-const List<T>& List<T>::operator=(const List& rhs) {
+template <class T, template <class> class Allocator, class Stats>
+const List<T, Allocator, Stats>&
+List<T, Allocator, Stats>::operator=(const List& rhs) {
    // verify this is not a self-assignment
    if (this == &rhs) { 
       return *this;
    }
    
    _size = rhs._size;
+   _cursor = 0;
+   
+   if (_shared != 0 || rhs._shared != 0) {
+      // count the new reference first, in case both already share nodes
+      if (rhs._shared != 0) {
+         rhs._shared->references.fetch_add(1);
+      }
+      releaseNodes(_first, _shared);
+      
+      _first = 0;
+      _shared = rhs._shared;
+      if (_shared != 0) {
+         _first = rhs._first;
+         return *this;
+      }
+   }
    
    // copy rhs's elements into a new list
-   copyList(rhs->_first,_first);
+   copyList(rhs._first,_first);
    
    return *this;
 }
@@ -271,22 +786,45 @@ const List<T>& List<T>::operator=(const List& rhs) {
 /********************** Input/Output *****************************************/
 /*****************************************************************************/
 
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Sink>
+bool List<T, Allocator, Stats>::addItemsTo(Sink& sink) const {
+   for (Node * ptr = _first; ptr != 0; ptr = ptr->next) {
+      if (!sink.add(ptr->data)) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
 /**
  * Output the list
  * 
- * Precondition: The ostream, out, is open.
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
  * Postcondition: The list represented by this List object has been inserted
- *    into out.
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
  */
-template <class T>
-void List<T>::display(std::ostream& out) const {
-   Node * ptr = _first;
-   while (ptr != 0) {
-      out << ptr->data << " ";
-      ptr=ptr->next;
-   }
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::display(std::ostream& out,
+                                        const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
 }
 
 /**
@@ -298,8 +836,9 @@ void List<T>::display(std::ostream& out) const {
  * 
  * Worst-Case Time Comlexity: O(n)
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& out, const List<T>& list) {
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream& out,
+                         const List<T, Allocator, Stats>& list) {
    list.display(out);
    
    return out;
@@ -309,6 +848,40 @@ std::ostream& operator<<(std::ostream& out, const List<T>& list) {
 /********************** Private Functions ************************************/
 /*****************************************************************************/
 
+/**
+ * Find the node at the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A pointer to the node at position is returned. The node is
+ *    remembered so that a later walk to the same or a later position can
+ *    start from it.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) amortized when positions are
+ *    visited in increasing order
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::findNode(const int& position) const {
+   Node * ptr = _first;
+   int i = 0;
+   
+   // resume from the remembered node if it is not past the target
+   if (_cursor != 0 && _cursorPosition <= position) {
+      ptr = _cursor;
+      i = _cursorPosition;
+   }
+   
+   this->countLinks(position-i);
+   for (; i<position; ++i) {
+      ptr = ptr->next;
+   }
+   
+   _cursor = ptr;
+   _cursorPosition = position;
+   
+   return ptr;
+}
+
 /**
  * Copy a linked list
  * 
@@ -317,22 +890,25 @@ std::ostream& operator<<(std::ostream& out, const List<T>& list) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::copyList(Node * originalListFirst,
+                                         Node * &copiedListFirst) {
    // if the original list is empty, then simply delete the anything held in
    // the copied list
    if (originalListFirst == 0) {
-      deleteList(copiedListFirst);
+      deleteList(copiedListFirst, pool());
+      copiedListFirst = 0;
       return true;
    }
    
    // if there is already a list held where the copied list should go, then 
    // delete that list
-   deleteList(copiedListFirst);
+   deleteList(copiedListFirst, pool());
    
    // copy the data from the first node
-   copiedListFirst = new Node;
+   copiedListFirst = createNode();
    copiedListFirst->data = originalListFirst->data;
+   this->countCopies(1);
    copiedListFirst->next = 0;
    
    // create a pointer to the current location in each list
@@ -341,11 +917,12 @@ bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
    
    // copy the data in the remaining nodes
    while (originalPtr->next!=0) {
-      copiedPtr->next = new Node;
+      copiedPtr->next = createNode();
       originalPtr = originalPtr->next;
       copiedPtr = copiedPtr->next;
       
       copiedPtr->data = originalPtr->data;
+      this->countCopies(1);
       copiedPtr->next = 0;
    }
    
@@ -357,15 +934,27 @@ bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
 /**
  * Delete a linked list
  * 
- * Precondition: The life of the linked list is over
+ * Precondition: The life of the linked list is over. firstPtr is the first
+ *    node of the list, and every node nodePool has handed out is in it.
  * Postcondition: The memory dynamically allocated by each node of the linked
  *    list is returned to the heap.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(number of chunks) when T has a trivial
+ *    destructor and the allocator releases in bulk; O(n) otherwise
  */
-template <class T>
-bool List<T>::deleteList(Node * firstPtr) {
-   if (firstPtr == 0) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::deleteList(Node * firstPtr,
+                                           Allocator<Node>& nodePool) {
+   if (Allocator<Node>::BULK_RELEASE) {
+      // the nodes only need to be visited if they have destructors to run
+      if (!std::is_trivially_destructible<T>::value) {
+         for (Node * ptr = firstPtr; ptr != 0; ptr = ptr->next) {
+            ptr->~Node();
+         }
+      }
+      
+      nodePool.releaseAll();
+      
       return true;
    }
    
@@ -374,12 +963,153 @@ bool List<T>::deleteList(Node * firstPtr) {
    while (ptr != 0) {
       Node * tempPtr = ptr;
       ptr = ptr->next;
-      delete tempPtr;
+      tempPtr->~Node();
+      nodePool.deallocate(tempPtr);
+   }
+   
+   return true;
+}
+
+/**
+ * Create a node
+ * 
+ * Precondition: N/A
+ * Postcondition: A default-constructed node, allocated from pool(), is
+ *    returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::createNode() {
+   this->countAllocation(sizeof(Node));
+   
+   return new (pool().allocate()) Node;
+}
+
+/**
+ * Destroy a node
+ * 
+ * Precondition: node was created by createNode and is no longer linked into
+ *    the list
+ * Postcondition: The node has been destroyed and its memory returned to
+ *    pool().
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::destroyNode(Node * node) {
+   node->~Node();
+   pool().deallocate(node);
+}
+
+/**
+ * Get the allocator the nodes of this list come from
+ * 
+ * Precondition: N/A
+ * Postcondition: The shared storage's pool is returned in copy-on-write mode,
+ *    and _pool otherwise.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+Allocator<typename List<T, Allocator, Stats>::Node>&
+List<T, Allocator, Stats>::pool() {
+   return (_shared != 0 ? _shared->pool : _pool);
+}
+
+/**
+ * Give the list nodes of its own if it shares them
+ * 
+ * Precondition: N/A
+ * Postcondition: If the nodes were shared with another list, the list now
+ *    holds a copy of them in new shared storage of its own, and true is
+ *    returned. Otherwise nothing has changed and false is returned.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) if the nodes are not shared
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::unshare() {
+   if (!isShared()) {
+      return false;
    }
    
-   firstPtr = 0;
+   return moveToStorage(new Storage);
+}
+
+/**
+ * Copy the nodes into other storage and let go of the current ones
+ * 
+ * Precondition: storage is new, unshared storage, or 0 for _pool (which
+ *    must then hold no nodes)
+ * Postcondition: The list's nodes are a copy of its previous nodes, allocated
+ *    from storage (or _pool), and _shared is storage. The previous nodes
+ *    have been released as by releaseNodes.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::moveToStorage(Storage * storage) {
+   Node * oldFirst = _first;
+   Storage * oldShared = _shared;
+   
+   _first = 0;
+   _shared = storage;
+   copyList(oldFirst, _first);
+   
+   releaseNodes(oldFirst, oldShared);
+   
+   // the remembered node belonged to the old nodes
+   _cursor = 0;
    
    return true;
 }
 
+/**
+ * Let go of a list's nodes
+ * 
+ * Precondition: first is the first of the nodes; shared is their storage, or
+ *    0 if they come from _pool
+ * Postcondition: The nodes have been returned to the heap, and the storage
+ *    deleted, unless other lists still share them.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) if other lists share the nodes
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::releaseNodes(Node * first, Storage * shared) {
+   if (shared == 0) {
+      deleteList(first, _pool);
+      return;
+   }
+   
+   if (shared->references.fetch_sub(1) == 1) {
+      deleteList(first, shared->pool);
+      delete shared;
+   }
+}
+
+/**
+ * Find the node of this list's own copy that corresponds to a shared node
+ * 
+ * Precondition: node is one of the nodes this list shares with a
+ *    copy-on-write copy
+ * Postcondition: The list has been given nodes of its own, and the one at
+ *    the position node held is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::findCopiedNode(Node * node) {
+   int position = 0;
+   for (Node * ptr = _first; ptr != node; ptr = ptr->next) {
+      ++position;
+   }
+   this->countLinks(position);
+   
+   unshare();
+   
+   return findNode(position);
+}
+
 #endif /*POINTER_LINKED_LIST_H_*/
\ No newline at end of file
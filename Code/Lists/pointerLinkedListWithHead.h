@@ -1,13 +1,25 @@
 #ifndef POINTER_LINKED_LIST_WITH_HEAD_H_
 #define POINTER_LINKED_LIST_WITH_HEAD_H_
 
+#include <functional>
 #include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
 
-template <typename T> class List;
-template <typename T> std::ostream& operator<<(std::ostream&, const List<T>&);
+#include "listStats.h"
+#include "listWriter.h"
+#include "nodePool.h"
+#include "nodeSort.h"
 
-template <class T>
-class List {
+template <typename T, template <class> class Allocator = NodePool,
+          class Stats = LIST_STATS> class List;
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, Allocator, Stats>&);
+
+template <class T, template <class> class Allocator, class Stats>
+class List : private Stats {
    private:
       class Node {
          public:            
@@ -17,6 +29,79 @@ class List {
             Node() { next = 0; }
       };
    public:
+      // forward iterators over the elements of the list. An iterator stays
+      // valid until the node it refers to is removed.
+      class iterator {
+         public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T * pointer;
+            typedef T & reference;
+            
+            iterator() { _node = 0; }
+            
+            reference operator*() const { return _node->data; }
+            pointer operator->() const { return &_node->data; }
+            
+            iterator& operator++() {
+               _node = _node->next;
+               return *this;
+            }
+            iterator operator++(int) {
+               iterator old = *this;
+               _node = _node->next;
+               return old;
+            }
+            
+            bool operator==(const iterator& rhs) const {
+               return _node == rhs._node;
+            }
+            bool operator!=(const iterator& rhs) const {
+               return _node != rhs._node;
+            }
+         private:
+            friend class List;
+            explicit iterator(Node * node) { _node = node; }
+            Node * _node;
+      };
+      
+      class const_iterator {
+         public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T * pointer;
+            typedef const T & reference;
+            
+            const_iterator() { _node = 0; }
+            const_iterator(const iterator& it) { _node = it._node; }
+            
+            reference operator*() const { return _node->data; }
+            pointer operator->() const { return &_node->data; }
+            
+            const_iterator& operator++() {
+               _node = _node->next;
+               return *this;
+            }
+            const_iterator operator++(int) {
+               const_iterator old = *this;
+               _node = _node->next;
+               return old;
+            }
+            
+            bool operator==(const const_iterator& rhs) const {
+               return _node == rhs._node;
+            }
+            bool operator!=(const const_iterator& rhs) const {
+               return _node != rhs._node;
+            }
+         private:
+            friend class List;
+            explicit const_iterator(const Node * node) { _node = node; }
+            const Node * _node;
+      };
+      
       List();
       List(const List&);
       
@@ -24,19 +109,57 @@ class List {
      
       int getSize() const;
       int getCapacity() const;
+      const Stats& getStats() const;
       
       bool isEmpty() const;
       bool insert(const T&, const int&);
       bool remove(const int&);
       
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      void sort();
+      template <class Compare>
+      void sort(Compare);
+      
+      iterator beforeBegin();
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      
+      iterator insertAfter(iterator, const T&);
+      iterator eraseAfter(iterator);
+      
       const List& operator=(const List&);
       
-      void display(std::ostream&) const;
-      friend std::ostream& operator<< <>(std::ostream&, const List<T>&);
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = true;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
    private:
       Node * _first; // pointer to the first element of the linked list
       int _size; // the number of elements stored in the linked list
       
+      // the node most recently reached by a positional walk, and its
+      // position (-1 for the head node). Walks to a later position resume
+      // from here instead of from _first, so scanning positions in order
+      // costs O(1) per step.
+      mutable Node * _cursor;
+      mutable int _cursorPosition;
+      
+      Node * findNode(const int&) const;
+      
+      // the nodes of this list are allocated from, and returned to, _pool
+      Allocator<Node> _pool;
+      
+      Node * createNode();
+      void destroyNode(Node *);
+      
       bool copyList(Node *, Node * &);
       bool deleteList(Node *);
 };
@@ -53,10 +176,12 @@ class List {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-List<T>::List() {
-   _first = new Node();
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List() {
+   _first = createNode();
    _size = 0;
+   _cursor = _first;
+   _cursorPosition = -1;
 }
 
 /**
@@ -68,14 +193,17 @@ List<T>::List() {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-List<T>::List(const List& originalList) { 
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::List(const List& originalList) { 
    // initialize an empty list
    _first = 0;
    _size = originalList._size;
    
    // copy the original list
    copyList(originalList._first, _first);
+   
+   _cursor = _first;
+   _cursorPosition = -1;
 }
 
 /*****************************************************************************/
@@ -91,8 +219,8 @@ List<T>::List(const List& originalList) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-List<T>::~List() {
+template <class T, template <class> class Allocator, class Stats>
+List<T, Allocator, Stats>::~List() {
    deleteList(_first);
 }
 
@@ -108,8 +236,8 @@ List<T>::~List() {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getSize() const {
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getSize() const {
    return _size;
 }
 
@@ -125,11 +253,25 @@ int List<T>::getSize() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-int List<T>::getCapacity() const {
+template <class T, template <class> class Allocator, class Stats>
+int List<T, Allocator, Stats>::getCapacity() const {
    return -1;
 }
 
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+const Stats& List<T, Allocator, Stats>::getStats() const {
+   return *this;
+}
+
 /**
  * Check if a list is empty
  * 
@@ -138,8 +280,8 @@ int List<T>::getCapacity() const {
  * 
  * Worst-Case Time Complexity: O(1)
  */
-template <class T>
-bool List<T>::isEmpty() const {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::isEmpty() const {
    return _size==0;
 }
 
@@ -156,22 +298,20 @@ bool List<T>::isEmpty() const {
  * 
  * Worst-case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::insert(const T& item, const int& position) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::insert(const T& item, const int& position) {
    // verify that this is an acceptable position
    if (position<0 || position>_size) {
       return false;
    }
    
    // create a new node with the specified data
-   Node * newNode = new Node;
+   Node * newNode = createNode();
    newNode->data = item;
+   this->countCopies(1);
    newNode->next = 0;
   
-   Node * predPtr = _first;
-   for (int i=0; i<position; ++i) {
-      predPtr = predPtr->next;
-   }
+   Node * predPtr = findNode(position-1);
    
    // insert the new element
    newNode->next = predPtr->next;
@@ -191,8 +331,8 @@ bool List<T>::insert(const T& item, const int& position) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::remove(const int& position) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::remove(const int& position) {
    // verify we can delete an element
    if (_size==0) {
       return false;
@@ -204,23 +344,264 @@ bool List<T>::remove(const int& position) {
    }
   
    // go to the appropriate position in the linked list to delete the item
-   Node * ptr = _first->next;
-   Node * predPtr = _first;
-   for (int i=0; i<position; ++i) {
-      predPtr = ptr;
-      ptr = ptr->next;
-   }
+   Node * predPtr = findNode(position-1);
+   Node * ptr = predPtr->next;
       
    // bypass the item to be deleted
    predPtr->next = ptr->next;
       
    // free the memory for the item to be deleted
-   delete ptr;
+   destroyNode(ptr);
    --_size;
    
    return true;
 }
 
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are input iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The list is walked to position only once and
+ *    the new nodes are spliced in as a single chain.
+ * 
+ * Worst-case Time Complexity: O(n+k), k being the number of items inserted
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Iterator>
+bool List<T, Allocator, Stats>::insertRange(Iterator first, Iterator last,
+                                            const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   // go to the appropriate position in the linked list to insert the items
+   Node * predPtr = findNode(position-1);
+   
+   // link each new node in after the previous one, then reattach the rest of
+   // the list behind the last new node
+   Node * rest = predPtr->next;
+   int count = 0;
+   for (; first!=last; ++first) {
+      Node * newNode = createNode();
+      newNode->data = *first;
+      this->countCopies(1);
+      
+      predPtr->next = newNode;
+      predPtr = newNode;
+      ++count;
+   }
+   predPtr->next = rest;
+   
+   _size += count;
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. The list is
+ *    walked to from only once.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   // go to the node before the first item to delete
+   Node * predPtr = findNode(from-1);
+   
+   // free the memory for the items to be deleted
+   Node * ptr = predPtr->next;
+   for (int i=from; i<to; ++i) {
+      Node * tempPtr = ptr;
+      ptr = ptr->next;
+      destroyNode(tempPtr);
+   }
+   this->countLinks(to-from);
+   
+   // bypass the deleted items
+   predPtr->next = ptr;
+   
+   _size -= to-from;
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare, equal elements in
+ *    the order they were in before. The nodes have been relinked by a
+ *    bottom-up merge sort (see nodeSort.h) and no element has moved, so
+ *    iterators still refer to the same elements.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Compare>
+void List<T, Allocator, Stats>::sort(Compare compare) {
+   _first->next = sortNodes(_first->next, _size, compare);
+   
+   // the remembered node is at another position now
+   _cursor = _first;
+   _cursorPosition = -1;
+}
+
+/**
+ * Get an iterator to the head node, which sits before the first element
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator that may be passed to insertAfter or eraseAfter
+ *    to operate on the front of the list is returned. It must not be
+ *    dereferenced.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::beforeBegin() {
+   return iterator(_first);
+}
+
+/**
+ * Get an iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator referring to the first element is returned, or
+ *    end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::begin() {
+   return iterator(_first->next);
+}
+
+/**
+ * Get an iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator that compares equal to an iterator advanced past
+ *    the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator List<T, Allocator, Stats>::end() {
+   return iterator(0);
+}
+
+/**
+ * Get a const iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator referring to the first element is returned,
+ *    or end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::const_iterator
+List<T, Allocator, Stats>::begin() const {
+   return const_iterator(_first->next);
+}
+
+/**
+ * Get a const iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator that compares equal to a const_iterator
+ *    advanced past the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::const_iterator
+List<T, Allocator, Stats>::end() const {
+   return const_iterator(0);
+}
+
+/**
+ * Insert an item directly after the node an iterator refers to
+ * 
+ * Preconditions: position is beforeBegin() or refers to an element of this
+ *    list (not end())
+ * Postcondition: item is inserted after position. An iterator to the new
+ *    element is returned. Existing iterators remain valid.
+ * 
+ * Worst-case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::insertAfter(iterator position, const T& item) {
+   Node * newNode = createNode();
+   newNode->data = item;
+   this->countCopies(1);
+   newNode->next = position._node->next;
+   position._node->next = newNode;
+   
+   // the positions of the remembered node are no longer known
+   _cursor = _first;
+   _cursorPosition = -1;
+   
+   ++_size;
+   
+   return iterator(newNode);
+}
+
+/**
+ * Remove the element directly after the node an iterator refers to
+ * 
+ * Preconditions: position is beforeBegin() or refers to an element of this
+ *    list that is not the last element
+ * Postcondition: The element after position has been removed. An iterator to
+ *    the element that followed it is returned. Iterators to the removed
+ *    element are invalidated.
+ * 
+ * Worst-case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::iterator
+List<T, Allocator, Stats>::eraseAfter(iterator position) {
+   Node * ptr = position._node->next;
+   position._node->next = ptr->next;
+   destroyNode(ptr);
+   
+   // the positions of the remembered node are no longer known
+   _cursor = _first;
+   _cursorPosition = -1;
+   
+   --_size;
+   
+   return iterator(position._node->next);
+}
+
 /*****************************************************************************/
 /********************** Operators ********************************************/
 /*****************************************************************************/
@@ -234,8 +615,9 @@ bool List<T>::remove(const int& position) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-const List<T>& List<T>::operator=(const List& rhs) {
+template <class T, template <class> class Allocator, class Stats>
+const List<T, Allocator, Stats>&
+List<T, Allocator, Stats>::operator=(const List& rhs) {
    // verify this is not a self-assignment
    if (this == &rhs) { 
       return *this;
@@ -244,7 +626,10 @@ const List<T>& List<T>::operator=(const List& rhs) {
    _size = rhs._size;
    
    // copy rhs's elements into a new list
-   copyList(rhs->_first,_first);
+   copyList(rhs._first,_first);
+   
+   _cursor = _first;
+   _cursorPosition = -1;
    
    return *this;
 }
@@ -253,22 +638,45 @@ const List<T>& List<T>::operator=(const List& rhs) {
 /********************** Input/Output *****************************************/
 /*****************************************************************************/
 
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, template <class> class Allocator, class Stats>
+template <class Sink>
+bool List<T, Allocator, Stats>::addItemsTo(Sink& sink) const {
+   for (Node * ptr = _first->next; ptr != 0; ptr = ptr->next) {
+      if (!sink.add(ptr->data)) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
 /**
  * Output the list
  * 
- * Precondition: The ostream, out, is open.
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
  * Postcondition: The list represented by this List object has been inserted
- *    into out.
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
  */
-template <class T>
-void List<T>::display(std::ostream& out) const {
-   Node * ptr = _first->next;
-   while (ptr != 0) {
-      out << ptr->data << " ";
-      ptr=ptr->next;
-   }
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::display(std::ostream& out,
+                                        const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
 }
 
 /**
@@ -280,8 +688,9 @@ void List<T>::display(std::ostream& out) const {
  * 
  * Worst-Case Time Comlexity: O(n)
  */
-template <typename T>
-std::ostream& operator<<(std::ostream& out, const List<T>& list) {
+template <typename T, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream& out,
+                         const List<T, Allocator, Stats>& list) {
    list.display(out);
    
    return out;
@@ -291,6 +700,40 @@ std::ostream& operator<<(std::ostream& out, const List<T>& list) {
 /********************** Private Functions ************************************/
 /*****************************************************************************/
 
+/**
+ * Find the node at the specified position
+ * 
+ * Precondition: -1 <= position < size, -1 being the head node
+ * Postcondition: A pointer to the node at position is returned. The node is
+ *    remembered so that a later walk to the same or a later position can
+ *    start from it.
+ * 
+ * Worst-Case Time Complexity: O(n); O(1) amortized when positions are
+ *    visited in increasing order
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::findNode(const int& position) const {
+   Node * ptr = _first;
+   int i = -1;
+   
+   // resume from the remembered node if it is not past the target
+   if (_cursorPosition <= position) {
+      ptr = _cursor;
+      i = _cursorPosition;
+   }
+   
+   this->countLinks(position-i);
+   for (; i<position; ++i) {
+      ptr = ptr->next;
+   }
+   
+   _cursor = ptr;
+   _cursorPosition = position;
+   
+   return ptr;
+}
+
 /**
  * Copy a linked list
  * 
@@ -299,12 +742,14 @@ std::ostream& operator<<(std::ostream& out, const List<T>& list) {
  * 
  * Worst-Case Time Complexity: O(n)
  */
-template <class T>
-bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::copyList(Node * originalListFirst,
+                                         Node * &copiedListFirst) {
    // if the original list is empty, then simply delete the anything held in
    // the copied list
    if (originalListFirst == 0) {
       deleteList(copiedListFirst);
+      copiedListFirst = 0;
       return true;
    }
    
@@ -313,8 +758,9 @@ bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
    deleteList(copiedListFirst);
    
    // copy the data from the first node
-   copiedListFirst = new Node;
+   copiedListFirst = createNode();
    copiedListFirst->data = originalListFirst->data;
+   this->countCopies(1);
    copiedListFirst->next = 0;
    
    // create a pointer to the current location in each list
@@ -323,11 +769,12 @@ bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
    
    // copy the data in the remaining nodes
    while (originalPtr->next!=0) {
-      copiedPtr->next = new Node;
+      copiedPtr->next = createNode();
       originalPtr = originalPtr->next;
       copiedPtr = copiedPtr->next;
       
       copiedPtr->data = originalPtr->data;
+      this->countCopies(1);
       copiedPtr->next = 0;
    }
    
@@ -339,15 +786,26 @@ bool List<T>::copyList(Node * originalListFirst, Node * &copiedListFirst) {
 /**
  * Delete a linked list
  * 
- * Precondition: The life of the linked list is over
+ * Precondition: The life of the linked list is over. firstPtr is the first
+ *    node of this list, so every node the pool has handed out is in it.
  * Postcondition: The memory dynamically allocated by each node of the linked
  *    list is returned to the heap.
  * 
- * Worst-Case Time Complexity: O(n)
+ * Worst-Case Time Complexity: O(number of chunks) when T has a trivial
+ *    destructor and the allocator releases in bulk; O(n) otherwise
  */
-template <class T>
-bool List<T>::deleteList(Node * firstPtr) {
-   if (firstPtr == 0) {
+template <class T, template <class> class Allocator, class Stats>
+bool List<T, Allocator, Stats>::deleteList(Node * firstPtr) {
+   if (Allocator<Node>::BULK_RELEASE) {
+      // the nodes only need to be visited if they have destructors to run
+      if (!std::is_trivially_destructible<T>::value) {
+         for (Node * ptr = firstPtr; ptr != 0; ptr = ptr->next) {
+            ptr->~Node();
+         }
+      }
+      
+      _pool.releaseAll();
+      
       return true;
    }
    
@@ -356,12 +814,43 @@ bool List<T>::deleteList(Node * firstPtr) {
    while (ptr != 0) {
       Node * tempPtr = ptr;
       ptr = ptr->next;
-      delete tempPtr;
+      destroyNode(tempPtr);
    }
    
-   firstPtr = 0;
-   
    return true;
 }
 
+/**
+ * Create a node
+ * 
+ * Precondition: N/A
+ * Postcondition: A default-constructed node, allocated from _pool, is
+ *    returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+typename List<T, Allocator, Stats>::Node *
+List<T, Allocator, Stats>::createNode() {
+   this->countAllocation(sizeof(Node));
+   
+   return new (_pool.allocate()) Node;
+}
+
+/**
+ * Destroy a node
+ * 
+ * Precondition: node was created by createNode and is no longer linked into
+ *    the list
+ * Postcondition: The node has been destroyed and its memory returned to
+ *    _pool.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, template <class> class Allocator, class Stats>
+void List<T, Allocator, Stats>::destroyNode(Node * node) {
+   node->~Node();
+   _pool.deallocate(node);
+}
+
 #endif /*POINTER_LINKED_LIST_WITH_HEAD_H_*/
\ No newline at end of file
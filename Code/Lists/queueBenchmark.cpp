@@ -0,0 +1,217 @@
+/*
+ * Throughput benchmark for the lock-free Queue against a List behind a
+ * mutex.
+ * 
+ *    g++ -O2 -pthread queueBenchmark.cpp
+ * 
+ * LIST_HEADER chooses the List variant the mutex guards; it defaults to
+ * circularArrayList.h, whose inserts at the back and removes at the front are
+ * both O(1), so the comparison measures the locking rather than the list.
+ * 
+ * For 1, 2, 4, ... up to --max-threads threads, every thread repeatedly
+ * enqueues an item and dequeues one, starting from a queue of PREFILL items.
+ * Each thread count is reported as one CSV or JSON row with the total
+ * operations, the wall-clock time per operation and the operations per
+ * second across all threads.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "lockFreeQueue.h"
+
+#ifndef LIST_HEADER
+#define LIST_HEADER "circularArrayList.h"
+#endif
+
+#include LIST_HEADER
+
+const int MAX_THREADS = 64; // most threads measured by default
+const long long DEFAULT_OPS = 2000000; // operations per thread count
+const int PREFILL = 1000; // items in the queue before the threads start
+
+/*****************************************************************************/
+/********************** Queues ***********************************************/
+/*****************************************************************************/
+
+/**
+ * A List used as a queue, one thread at a time.
+ * 
+ * The List interface has no way to read an element, so dequeue removes the
+ * front item without copying it out; the lock-free Queue pays for that copy.
+ */
+class LockedList {
+   public:
+      bool enqueue(const int& item) {
+         std::lock_guard<std::mutex> lock(_lock);
+         return _list.insert(item, _list.getSize());
+      }
+      
+      bool dequeue(int& item) {
+         std::lock_guard<std::mutex> lock(_lock);
+         if (_list.isEmpty()) {
+            return false;
+         }
+         item = 0;
+         return _list.remove(0);
+      }
+   private:
+      std::mutex _lock;
+      List<int> _list;
+};
+
+/*****************************************************************************/
+/********************** Measurement ******************************************/
+/*****************************************************************************/
+
+struct Measurement {
+   long long ops;
+   double nanoseconds;
+};
+
+using namespace std;
+
+template <class Q>
+bool measure(const int&, const long long&, Measurement&);
+template <class Q>
+void work(Q *, const long long, atomic<bool> *, long long *);
+void report(const char *, const int&, const Measurement&, const bool&);
+
+int main(int argc, char * argv[]) {
+   bool json = false;
+   bool header = true;
+   int maxThreads = MAX_THREADS;
+   long long ops = DEFAULT_OPS;
+   
+   for (int i=1; i<argc; ++i) {
+      if (strcmp(argv[i], "--format") == 0 && i+1<argc) {
+         json = strcmp(argv[++i], "json") == 0;
+      } else if (strcmp(argv[i], "--max-threads") == 0 && i+1<argc) {
+         maxThreads = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--ops") == 0 && i+1<argc) {
+         ops = atoll(argv[++i]);
+      } else if (strcmp(argv[i], "--no-header") == 0) {
+         header = false;
+      } else {
+         cerr << "usage: " << argv[0] << " [--format csv|json]"
+              << " [--max-threads n] [--ops n] [--no-header]" << endl;
+         return 1;
+      }
+   }
+   
+   if (header && !json) {
+      cout << "variant,threads,ops,ns_per_op,ops_per_second" << endl;
+   }
+   
+   for (int threads=1; threads<=maxThreads; threads*=2) {
+      Measurement measurement;
+      
+      if (measure<Queue<int> >(threads, ops, measurement)) {
+         report("lockFreeQueue", threads, measurement, json);
+      }
+      if (measure<LockedList>(threads, ops, measurement)) {
+         report("mutexList", threads, measurement, json);
+      }
+   }
+   
+   return 0;
+}
+
+/**
+ * Time threads threads sharing one queue
+ * 
+ * Precondition: threads > 0; ops > 0
+ * Postcondition: threads threads have run about ops operations between them
+ *    (half enqueues, half dequeues) on a queue of type Q holding PREFILL
+ *    items, all released at once. The operations run and the wall-clock time
+ *    from release to the last thread finishing are in measurement. Returns
+ *    false if the queue could not be filled.
+ */
+template <class Q>
+bool measure(const int& threads, const long long& ops,
+             Measurement& measurement) {
+   Q queue;
+   for (int i=0; i<PREFILL; ++i) {
+      if (!queue.enqueue(i)) {
+         return false;
+      }
+   }
+   
+   atomic<bool> start(false);
+   vector<long long> done(threads, 0);
+   vector<thread> workers;
+   
+   long long pairs = ops/2/threads;
+   for (int i=0; i<threads; ++i) {
+      workers.push_back(thread(work<Q>, &queue, pairs, &start, &done[i]));
+   }
+   
+   chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+   start.store(true);
+   for (int i=0; i<threads; ++i) {
+      workers[i].join();
+   }
+   chrono::steady_clock::time_point end = chrono::steady_clock::now();
+   
+   measurement.ops = 0;
+   for (int i=0; i<threads; ++i) {
+      measurement.ops += done[i];
+   }
+   measurement.nanoseconds = chrono::duration<double, nano>(end-begin).count();
+   
+   return measurement.ops > 0;
+}
+
+/**
+ * The body of one benchmark thread
+ * 
+ * Precondition: queue is shared by every thread of the measurement
+ * Postcondition: Once start was set, pairs enqueues have been run, each
+ *    followed by a dequeue. The number of operations that succeeded is in
+ *    *done.
+ */
+template <class Q>
+void work(Q * queue, const long long pairs, atomic<bool> * start,
+          long long * done) {
+   while (!start->load()) {
+      this_thread::yield();
+   }
+   
+   long long succeeded = 0;
+   int item = 0;
+   for (long long i=0; i<pairs; ++i) {
+      succeeded += queue->enqueue(static_cast<int>(i));
+      succeeded += queue->dequeue(item);
+   }
+   
+   *done = succeeded;
+}
+
+/**
+ * Output one measurement as a CSV row or a JSON object on its own line
+ * 
+ * Precondition: measurement.ops > 0
+ * Postcondition: The row has been inserted into cout.
+ */
+void report(const char * variant, const int& threads,
+            const Measurement& measurement, const bool& json) {
+   double ops = static_cast<double>(measurement.ops);
+   double nanosecondsPerOp = measurement.nanoseconds/ops;
+   
+   if (json) {
+      cout << "{\"variant\":\"" << variant << "\""
+           << ",\"threads\":" << threads
+           << ",\"ops\":" << measurement.ops
+           << ",\"ns_per_op\":" << nanosecondsPerOp
+           << ",\"ops_per_second\":" << 1e9/nanosecondsPerOp << "}" << endl;
+   } else {
+      cout << variant << "," << threads << "," << measurement.ops
+           << "," << nanosecondsPerOp
+           << "," << 1e9/nanosecondsPerOp << endl;
+   }
+}
@@ -0,0 +1,182 @@
+/*
+ * Benchmark for the vectorized searches of the array-backed lists.
+ * 
+ *    g++ -O2 searchBenchmark.cpp
+ *    g++ -O2 -mavx2 searchBenchmark.cpp
+ * 
+ * LIST_HEADER chooses the List variant (dynamicArrayList.h by default) and
+ * ITEM_TYPE its element type (int by default). arrayList.h shares the same
+ * kernels, but holds its elements inline and so cannot reach the larger
+ * sizes.
+ * 
+ * At sizes 10^3, 10^4, ... up to --max-size, every list is searched for an
+ * item it does not hold, so each search reads every element. find and count
+ * are the list's own indexOf and count; naiveFind and naiveCount are the
+ * plain loops from arraySearch.h over a copy of the same elements. Each
+ * search and size is reported as one CSV or JSON row with the time per
+ * search, the time per element and the speedup over the naive loop.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#ifndef LIST_HEADER
+#define LIST_HEADER "dynamicArrayList.h"
+#endif
+
+#include LIST_HEADER
+
+#ifndef ITEM_TYPE
+#define ITEM_TYPE int
+#endif
+
+typedef ITEM_TYPE Item;
+
+const int MIN_SIZE = 1000; // smallest list size measured
+const int MAX_SIZE = 10000000; // largest list size measured by default
+const int DEFAULT_BUDGET_MS = 100; // timed milliseconds per search and size
+
+/*****************************************************************************/
+/********************** Measurement ******************************************/
+/*****************************************************************************/
+
+struct Fixture {
+   List<Item> * list;
+   std::vector<Item> items; // the same elements, for the naive loops
+   Item missing; // an item the list does not hold
+};
+
+using namespace std;
+
+// results are added up here, so the searches cannot be optimized away
+static volatile long long sink = 0;
+
+int naiveFind(const Fixture& fixture) {
+   return findItemScalar(fixture.items.data(),
+                         static_cast<int>(fixture.items.size()),
+                         fixture.missing);
+}
+
+int listFind(const Fixture& fixture) {
+   return fixture.list->indexOf(fixture.missing);
+}
+
+int naiveCount(const Fixture& fixture) {
+   return countItemsScalar(fixture.items.data(),
+                           static_cast<int>(fixture.items.size()),
+                           fixture.missing);
+}
+
+int listCount(const Fixture& fixture) {
+   return fixture.list->count(fixture.missing);
+}
+
+double measure(int (*)(const Fixture&), const Fixture&, const int&);
+void report(const char *, const int&, const double&, const double&,
+            const bool&);
+
+int main(int argc, char * argv[]) {
+   bool json = false;
+   bool header = true;
+   int maxSize = MAX_SIZE;
+   int budget = DEFAULT_BUDGET_MS;
+   
+   for (int i=1; i<argc; ++i) {
+      if (strcmp(argv[i], "--format") == 0 && i+1<argc) {
+         json = strcmp(argv[++i], "json") == 0;
+      } else if (strcmp(argv[i], "--max-size") == 0 && i+1<argc) {
+         maxSize = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--budget-ms") == 0 && i+1<argc) {
+         budget = atoi(argv[++i]);
+      } else if (strcmp(argv[i], "--no-header") == 0) {
+         header = false;
+      } else {
+         cerr << "usage: " << argv[0] << " [--format csv|json]"
+              << " [--max-size n] [--budget-ms n] [--no-header]" << endl;
+         return 1;
+      }
+   }
+   
+   if (header && !json) {
+      cout << "variant,size,ns_per_op,ns_per_element,speedup" << endl;
+   }
+   
+   for (int size=MIN_SIZE; size<=maxSize; size*=10) {
+      Fixture fixture;
+      fixture.list = new List<Item>;
+      fixture.missing = static_cast<Item>(101);
+      
+      // small values that are never the missing one
+      for (int i=0; i<size; ++i) {
+         Item item = static_cast<Item>(i%100);
+         fixture.list->insert(item, i);
+         fixture.items.push_back(item);
+      }
+      
+      double naive = measure(naiveFind, fixture, budget);
+      report("naiveFind", size, naive, naive, json);
+      report("find", size, measure(listFind, fixture, budget), naive, json);
+      
+      naive = measure(naiveCount, fixture, budget);
+      report("naiveCount", size, naive, naive, json);
+      report("count", size, measure(listCount, fixture, budget), naive,
+             json);
+      
+      delete fixture.list;
+   }
+   
+   return 0;
+}
+
+/**
+ * Time a search
+ * 
+ * Precondition: budget > 0
+ * Postcondition: search has been run on fixture repeatedly for about budget
+ *    milliseconds, and at least once. The mean nanoseconds per run are
+ *    returned.
+ */
+double measure(int (*search)(const Fixture&), const Fixture& fixture,
+               const int& budget) {
+   chrono::steady_clock::time_point begin = chrono::steady_clock::now();
+   chrono::steady_clock::time_point end = begin;
+   long long runs = 0;
+   
+   // check the clock only every so often, so it is not what is measured
+   while (chrono::duration<double, milli>(end-begin).count() < budget) {
+      for (int i=0; i<16; ++i) {
+         sink = sink+search(fixture);
+      }
+      runs += 16;
+      end = chrono::steady_clock::now();
+   }
+   
+   return chrono::duration<double, nano>(end-begin).count()/runs;
+}
+
+/**
+ * Output one measurement as a CSV row or a JSON object on its own line
+ * 
+ * Precondition: size > 0; nanoseconds > 0
+ * Postcondition: The row, with the speedup of nanoseconds over naive, has
+ *    been inserted into cout.
+ */
+void report(const char * variant, const int& size, const double& nanoseconds,
+            const double& naive, const bool& json) {
+   double nanosecondsPerElement = nanoseconds/size;
+   double speedup = naive/nanoseconds;
+   
+   if (json) {
+      cout << "{\"variant\":\"" << variant << "\""
+           << ",\"size\":" << size
+           << ",\"ns_per_op\":" << nanoseconds
+           << ",\"ns_per_element\":" << nanosecondsPerElement
+           << ",\"speedup\":" << speedup << "}" << endl;
+   } else {
+      cout << variant << "," << size << "," << nanoseconds
+           << "," << nanosecondsPerElement << "," << speedup << endl;
+   }
+}
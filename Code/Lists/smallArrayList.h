@@ -0,0 +1,703 @@
+#ifndef SMALL_ARRAY_LIST_H_
+#define SMALL_ARRAY_LIST_H_
+
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "arraySort.h"
+#include "arrayStorage.h"
+#include "listStats.h"
+#include "listWriter.h"
+
+// the number of elements a List<T> stores inline when none is given
+const int INLINE_CAPACITY = 16;
+
+template <typename T, int N = INLINE_CAPACITY,
+          class Stats = LIST_STATS> class List;
+template <typename T, int N, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, N, Stats>&);
+
+/**
+ * An array list that stores up to N elements inside the list object itself
+ * and only moves them to a heap array, grown like dynamicArrayList.h's, once
+ * the list outgrows that inline buffer. Small lists never touch the heap.
+ */
+template <class T, int N, class Stats>
+class List : private Stats {
+   public:
+      List();
+      List(const List&);
+      List(List&&)
+         noexcept(std::is_nothrow_move_constructible<T>::value);
+      
+      ~List();
+      
+      int getSize() const;
+      int getCapacity() const;
+      const Stats& getStats() const;
+      
+      bool isEmpty() const;
+      bool isInline() const;
+      bool insert(const T&, const int&);
+      bool insert(T&&, const int&);
+      bool remove(const int&);
+      
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      void sort();
+      template <class Compare>
+      void sort(Compare);
+      
+      bool reserve(const int&);
+      bool shrinkToFit();
+      
+      const List& operator=(const List&);
+      const List& operator=(List&&)
+         noexcept(std::is_nothrow_move_constructible<T>::value);
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = false;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
+   private:
+      // raw storage for the first N elements
+      alignas(T) unsigned char _inlineItems[N*sizeof(T)];
+      
+      // array to store list elements: either _inlineItems or a heap array.
+      // Only the first _size slots hold constructed objects.
+      T * _items;
+      int _capacity; // N while inline, else the size of the heap array
+      int _size; // current size of the list stored in _items
+      
+      T * inlineItems();
+      bool resize(const int&);
+      bool makeRoom(const int&, const int&);
+      bool takeItems(List&);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty list, with size 0, using its inline storage.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+List<T, N, Stats>::List() {
+   _items = inlineItems();
+   _capacity = N;
+   _size = 0;
+}
+
+/**
+ * Construct a copy of a List object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A copy of originalList has been constructed. It is inline if
+ *    the elements fit in N slots.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+List<T, N, Stats>::List(const List& originalList) {
+   _items = inlineItems();
+   _capacity = N;
+   _size = 0;
+   
+   if (originalList._size > N) {
+      _items = allocateItems<T>(originalList._size);
+      _capacity = originalList._size;
+      this->countAllocation(_capacity*sizeof(T));
+   }
+   
+   copyItems(originalList._items, _items, originalList._size);
+   _size = originalList._size;
+   this->countCopies(_size);
+}
+
+/**
+ * Construct a list object from the elements of another list.
+ * 
+ * Precondition: originalList is an rvalue whose contents are no longer needed
+ * Postcondition: This list holds the elements originalList held.
+ *    originalList is empty and inline. A heap array is taken over without
+ *    copying; inline elements are moved one by one.
+ * 
+ * Worst-Case Time Complexity: O(1) if originalList is on the heap; O(N)
+ *    otherwise
+ */
+template <class T, int N, class Stats>
+List<T, N, Stats>::List(List&& originalList)
+      noexcept(std::is_nothrow_move_constructible<T>::value) {
+   _items = inlineItems();
+   _capacity = N;
+   _size = 0;
+   
+   takeItems(originalList);
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The elements of the list have been destroyed and any heap
+ *    array has been returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+List<T, N, Stats>::~List() {
+   destroyItems(_items, _size);
+   
+   if (!isInline()) {
+      deallocateItems(_items);
+   }
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+int List<T, N, Stats>::getSize() const {
+   return _size;
+}
+
+/**
+ * Get the capacity of a list object.
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements the list can hold without allocating
+ *    is returned: N while the list is inline.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+int List<T, N, Stats>::getCapacity() const {
+   return _capacity;
+}
+
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+const Stats& List<T, N, Stats>::getStats() const {
+   return *this;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::isEmpty() const {
+   return _size==0;
+}
+
+/**
+ * Check if a list is using its inline storage
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if the elements are stored inside the list
+ *    object and false if they have spilled to the heap
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::isInline() const {
+   return static_cast<const void *>(_items) ==
+          static_cast<const void *>(_inlineItems);
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Insert an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item is inserted into the list at the specified position.
+ *    The list spills to the heap if it has outgrown its inline storage.
+ * 
+ * Worst-case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::insert(const T& item, const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   makeRoom(position, 1);
+   
+   // construct the new element in the correct position
+   new (_items+position) T(item);
+   this->countCopies(1);
+   
+   // increment the size of the current list
+   ++_size;
+   
+   return true;
+}
+
+/**
+ * Move an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item has been moved into the list at the specified position.
+ * 
+ * Worst-case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::insert(T&& item, const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   makeRoom(position, 1);
+   
+   // construct the new element in the correct position
+   new (_items+position) T(std::move(item));
+   this->countMoves(1);
+   
+   // increment the size of the current list
+   ++_size;
+   
+   return true;
+}
+
+/**
+ * Remove the item at the specified position
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: element at the specified position has been removed.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::remove(const int& position) {
+   // verify we can delete an element
+   if (_size==0) {
+      return false;
+   }
+   
+   // verify this is a valid item to delete
+   if (position<0 || position>=_size) {
+      return false;
+   }
+   
+   return removeRange(position, position+1);
+}
+
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are forward iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. The list grows at most once and the elements
+ *    after position are shifted only once.
+ * 
+ * Worst-case Time Complexity: O(n+k), k being the number of items inserted
+ */
+template <class T, int N, class Stats>
+template <class Iterator>
+bool List<T, N, Stats>::insertRange(Iterator first, Iterator last,
+                                    const int& position) {
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   int count = static_cast<int>(std::distance(first, last));
+   if (count<0) {
+      return false;
+   }
+   
+   makeRoom(position, count);
+   
+   // construct the new elements in the gap
+   for (int i=position; first!=last; ++first, ++i) {
+      new (_items+i) T(*first);
+   }
+   this->countCopies(count);
+   
+   _size += count;
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed. The elements
+ *    after them are shifted left only once. The heap array is kept; call
+ *    shrinkToFit to move a small list back inline.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   closeGap(_items, _size, from, to);
+   this->countShifts(from<to ? _size-to : 0);
+   
+   _size -= to-from;
+   
+   return true;
+}
+
+/**
+ * Sort the list into ascending order
+ * 
+ * Precondition: T has operator<
+ * Postcondition: The elements are in ascending order, as for sort(compare)
+ *    with std::less<T>.
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, int N, class Stats>
+void List<T, N, Stats>::sort() {
+   sort(std::less<T>());
+}
+
+/**
+ * Sort the list
+ * 
+ * Precondition: compare is a strict weak ordering on the elements
+ * Postcondition: The elements are in order by compare. Equal elements may
+ *    have changed order. The list is sorted in place by introsort (see
+ *    arraySort.h).
+ * 
+ * Worst-Case Time Complexity: O(n log n)
+ */
+template <class T, int N, class Stats>
+template <class Compare>
+void List<T, N, Stats>::sort(Compare compare) {
+   sortItems(_items, _size, compare);
+}
+
+/**
+ * Reserve memory for at least capacity elements
+ * 
+ * Preconditions: capacity >= 0
+ * Postconditions: getCapacity() >= capacity. Returns false if capacity is
+ *    negative.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::reserve(const int& capacity) {
+   if (capacity<0) {
+      return false;
+   }
+   
+   if (capacity > _capacity) {
+      resize(capacity);
+   }
+   
+   return true;
+}
+
+/**
+ * Release any unused memory
+ * 
+ * Preconditions: N/A
+ * Postconditions: A list of at most N elements is back in its inline storage
+ *    and owns no heap memory. A larger list's heap array is exactly its size.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::shrinkToFit() {
+   if (!isInline() && _size != _capacity) {
+      resize(_size);
+   }
+   
+   return true;
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Assign a copy of a list object to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: A copy of rhs has been assigned to this object. A const
+ *    reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+const List<T, N, Stats>& List<T, N, Stats>::operator=(const List& rhs) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   destroyItems(_items, _size);
+   _size = 0;
+   
+   // allocate a bigger array, if necessary
+   if (rhs._size > _capacity) {
+      if (!isInline()) {
+         deallocateItems(_items);
+      }
+      
+      _items = allocateItems<T>(rhs._size);
+      _capacity = rhs._size;
+      this->countAllocation(_capacity*sizeof(T));
+   }
+   
+   // copy rhs's elements into the array
+   copyItems(rhs._items, _items, rhs._size);
+   _size = rhs._size;
+   this->countCopies(_size);
+   
+   return *this;
+}
+
+/**
+ * Move a list object into the current object
+ * 
+ * Preconditions: rhs is an rvalue whose contents are no longer needed
+ * Postconditions: This list holds rhs's elements and its previous elements
+ *    have been destroyed. rhs is empty and inline. A const reference to this
+ *    list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n) to destroy the previous elements
+ */
+template <class T, int N, class Stats>
+const List<T, N, Stats>& List<T, N, Stats>::operator=(List&& rhs)
+      noexcept(std::is_nothrow_move_constructible<T>::value) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   destroyItems(_items, _size);
+   if (!isInline()) {
+      deallocateItems(_items);
+   }
+   
+   _items = inlineItems();
+   _capacity = N;
+   _size = 0;
+   
+   takeItems(rhs);
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, int N, class Stats>
+template <class Sink>
+bool List<T, N, Stats>::addItemsTo(Sink& sink) const {
+   for (int i=0; i<_size; ++i) {
+      if (!sink.add(_items[i])) {
+         return false;
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this List object has been inserted
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, int N, class Stats>
+void List<T, N, Stats>::display(std::ostream& out, const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T, int N, class Stats>
+std::ostream& operator<<(std::ostream& out, const List<T, N, Stats>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Get the inline storage as an array of T
+ * 
+ * Precondition: N/A
+ * Postcondition: A pointer to the first inline slot is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int N, class Stats>
+T * List<T, N, Stats>::inlineItems() {
+   return reinterpret_cast<T *>(_inlineItems);
+}
+
+/**
+ * Move the list into storage of a different capacity
+ * 
+ * Precondition: newCapacity >= size
+ * Postcondition: If newCapacity <= N the list is in its inline storage;
+ *    otherwise _items points to a new heap array of newCapacity elements. Any
+ *    old heap array has been returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::resize(const int& newCapacity) {
+   T * copiedItems;
+   if (newCapacity <= N) {
+      if (isInline()) {
+         return true;
+      }
+      copiedItems = inlineItems();
+   } else {
+      copiedItems = allocateItems<T>(newCapacity);
+      this->countAllocation(newCapacity*sizeof(T));
+   }
+   
+   moveItems(_items, copiedItems, _size);
+   this->countMoves(_size);
+   
+   if (!isInline()) {
+      deallocateItems(_items);
+   }
+   
+   _items = copiedItems;
+   _capacity = (newCapacity <= N ? N : newCapacity);
+   
+   return true;
+}
+
+/**
+ * Make count unconstructed slots at position, spilling to (or growing) the
+ * heap array if needed
+ * 
+ * Precondition: 0 <= position <= size; count >= 0
+ * Postcondition: The elements at position and beyond have been shifted count
+ *    slots to the right, leaving raw memory for the new elements. The size
+ *    is unchanged.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::makeRoom(const int& position, const int& count) {
+   // grow the array geometrically so that n inserts cost O(n) overall
+   if (count > _capacity-_size) {
+      resize(grownCapacity(_capacity, _size+count, DEFAULT_GROWTH_FACTOR));
+   }
+   
+   // shift elements to the right to make space for the new elements
+   openGap(_items, _size, position, count);
+   this->countShifts(count>0 ? _size-position : 0);
+   
+   return true;
+}
+
+/**
+ * Take the elements of another list
+ * 
+ * Precondition: This list is empty and inline.
+ * Postcondition: This list holds the elements originalList held, taking over
+ *    its heap array if it had one. originalList is empty and inline.
+ * 
+ * Worst-Case Time Complexity: O(1) if originalList is on the heap; O(N)
+ *    otherwise
+ */
+template <class T, int N, class Stats>
+bool List<T, N, Stats>::takeItems(List& originalList) {
+   if (originalList.isInline()) {
+      moveItems(originalList._items, _items, originalList._size);
+      this->countMoves(originalList._size);
+   } else {
+      _items = originalList._items;
+      _capacity = originalList._capacity;
+      
+      originalList._items = originalList.inlineItems();
+      originalList._capacity = N;
+   }
+   
+   _size = originalList._size;
+   originalList._size = 0;
+   
+   return true;
+}
+
+#endif /*SMALL_ARRAY_LIST_H_*/
@@ -0,0 +1,846 @@
+#ifndef UNROLLED_LINKED_LIST_H_
+#define UNROLLED_LINKED_LIST_H_
+
+#include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "arrayStorage.h"
+#include "listStats.h"
+#include "listWriter.h"
+#include "nodePool.h"
+
+// the number of elements each node holds when none is given
+const int NODE_CAPACITY = 64;
+
+template <typename T, int K = NODE_CAPACITY,
+          template <class> class Allocator = NodePool,
+          class Stats = LIST_STATS> class List;
+template <typename T, int K, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream&, const List<T, K, Allocator, Stats>&);
+
+/**
+ * An unrolled linked list: each node holds a small array of up to K
+ * elements instead of a single one. A full node is split in half on insert,
+ * and a node less than half full after a remove takes elements from, or is
+ * merged with, the node after it. Every node but the last is therefore at
+ * least half full, and a walk to a position skips K/2 or more elements per
+ * node instead of one.
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+class List : private Stats {
+   static_assert(K >= 2, "an unrolled list node must hold at least 2 items");
+   private:
+      class Node {
+         public:
+            Node() { count = 0; next = 0; }
+            ~Node() { destroyItems(items(), count); }
+            
+            T * items() { return reinterpret_cast<T *>(storage); }
+            const T * items() const {
+               return reinterpret_cast<const T *>(storage);
+            }
+            
+            // raw storage for K elements; only the first count are
+            // constructed
+            alignas(T) unsigned char storage[K*sizeof(T)];
+            int count;
+            Node * next;
+      };
+   public:
+      // forward iterators over the elements of the list. An iterator is
+      // invalidated by any insert or remove.
+      class iterator {
+         public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef T * pointer;
+            typedef T & reference;
+            
+            iterator() { _node = 0; _index = 0; }
+            
+            reference operator*() const { return _node->items()[_index]; }
+            pointer operator->() const { return _node->items()+_index; }
+            
+            iterator& operator++() {
+               advance();
+               return *this;
+            }
+            iterator operator++(int) {
+               iterator old = *this;
+               advance();
+               return old;
+            }
+            
+            bool operator==(const iterator& rhs) const {
+               return _node == rhs._node && _index == rhs._index;
+            }
+            bool operator!=(const iterator& rhs) const {
+               return !(*this == rhs);
+            }
+         private:
+            friend class List;
+            iterator(Node * node, int index) { _node = node; _index = index; }
+            
+            // step to the next element; only the last node can be empty
+            void advance() {
+               if (++_index == _node->count) {
+                  _node = _node->next;
+                  _index = 0;
+                  if (_node != 0 && _node->count == 0) {
+                     _node = 0;
+                  }
+               }
+            }
+            
+            Node * _node;
+            int _index;
+      };
+      
+      class const_iterator {
+         public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T * pointer;
+            typedef const T & reference;
+            
+            const_iterator() { _node = 0; _index = 0; }
+            const_iterator(const iterator& it) {
+               _node = it._node;
+               _index = it._index;
+            }
+            
+            reference operator*() const { return _node->items()[_index]; }
+            pointer operator->() const { return _node->items()+_index; }
+            
+            const_iterator& operator++() {
+               advance();
+               return *this;
+            }
+            const_iterator operator++(int) {
+               const_iterator old = *this;
+               advance();
+               return old;
+            }
+            
+            bool operator==(const const_iterator& rhs) const {
+               return _node == rhs._node && _index == rhs._index;
+            }
+            bool operator!=(const const_iterator& rhs) const {
+               return !(*this == rhs);
+            }
+         private:
+            friend class List;
+            const_iterator(const Node * node, int index) {
+               _node = node;
+               _index = index;
+            }
+            
+            void advance() {
+               if (++_index == _node->count) {
+                  _node = _node->next;
+                  _index = 0;
+                  if (_node != 0 && _node->count == 0) {
+                     _node = 0;
+                  }
+               }
+            }
+            
+            const Node * _node;
+            int _index;
+      };
+      
+      List();
+      List(const List&);
+      
+      ~List();
+      
+      int getSize() const;
+      int getCapacity() const;
+      const Stats& getStats() const;
+      
+      bool isEmpty() const;
+      bool insert(const T&, const int&);
+      bool remove(const int&);
+      
+      template <class Iterator>
+      bool insertRange(Iterator, Iterator, const int&);
+      bool removeRange(const int&, const int&);
+      
+      iterator begin();
+      iterator end();
+      const_iterator begin() const;
+      const_iterator end() const;
+      
+      const List& operator=(const List&);
+      
+      // whether display puts a space after every element (see listWriter.h)
+      static constexpr bool DISPLAY_TERMINATED = true;
+      
+      template <class Sink>
+      bool addItemsTo(Sink&) const;
+      void display(std::ostream&, const int& limit=DISPLAY_ALL) const;
+      friend std::ostream& operator<< <>(std::ostream&, const List&);
+   private:
+      Node * _first; // pointer to the first node of the linked list
+      int _size; // the number of elements stored in the linked list
+      
+      // the node most recently reached by a positional walk, and the
+      // position of its first element. Walks to a later position resume
+      // from here instead of from _first. Inserts and removes only change
+      // this node and the ones after it, so it stays valid across them.
+      // _cursor is 0 when no node is remembered.
+      mutable Node * _cursor;
+      mutable int _cursorPosition;
+      
+      Node * findNode(const int&, int&) const;
+      void rebalance(Node *);
+      
+      // the nodes of this list are allocated from, and returned to, _pool
+      Allocator<Node> _pool;
+      
+      Node * createNode();
+      void destroyNode(Node *);
+      
+      bool copyList(Node *, Node * &);
+      bool deleteList(Node *);
+};
+
+/*****************************************************************************/
+/********************** Constructors *****************************************/
+/*****************************************************************************/
+
+/**
+ * Default Constructor: construct a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty list, with size 0, is created.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+List<T, K, Allocator, Stats>::List() {
+   _first = 0;
+   _size = 0;
+   _cursor = 0;
+   _cursorPosition = 0;
+}
+
+/**
+ * Construct a copy of a List object.
+ * 
+ * Precondition: A copy of originalList is needed. originalList is a const
+ *    reference parameter
+ * Postcondition: A copy of originalList has been constructed.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+List<T, K, Allocator, Stats>::List(const List& originalList) {
+   // initialize an empty list
+   _first = 0;
+   _size = originalList._size;
+   _cursor = 0;
+   _cursorPosition = 0;
+   
+   // copy the original list
+   copyList(originalList._first, _first);
+}
+
+/*****************************************************************************/
+/********************** Destruction ******************************************/
+/*****************************************************************************/
+
+/**
+ * Destroy a list object
+ * 
+ * Precondition: The life of the object is over.
+ * Postcondition: The memory dynamically allocated by the linked list has been
+ *    returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+List<T, K, Allocator, Stats>::~List() {
+   deleteList(_first);
+}
+
+/*****************************************************************************/
+/********************** Accessors ********************************************/
+/*****************************************************************************/
+
+/**
+ * Get the size of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The number of elements held in the list is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+int List<T, K, Allocator, Stats>::getSize() const {
+   return _size;
+}
+
+/**
+ * Get the capacity of a list object.
+ * 
+ * Note that this function is only provided for compatability with other list
+ * implementations.
+ * 
+ * Precondition: N/A
+ * Postcondition: -1 is returned since a linked list has no predefined
+ *    capacity
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+int List<T, K, Allocator, Stats>::getCapacity() const {
+   return -1;
+}
+
+/**
+ * Get the instrumentation of a list object
+ * 
+ * Precondition: N/A
+ * Postcondition: The Stats policy of the list is returned. With ListStats,
+ *    its getCounters() tells what the list has done (see listStats.h).
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+const Stats& List<T, K, Allocator, Stats>::getStats() const {
+   return *this;
+}
+
+/**
+ * Check if a list is empty
+ * 
+ * Precondition: N/A
+ * Postcondition: Return true if list is empty and false otherwise
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+bool List<T, K, Allocator, Stats>::isEmpty() const {
+   return _size==0;
+}
+
+/*****************************************************************************/
+/********************** Functions ********************************************/
+/*****************************************************************************/
+
+/**
+ * Insert an item into the list at the specified position
+ * 
+ * Preconditions: item is the value to be inserted; 0 <= position <= size
+ * Postcondition: item is inserted into the list at the specified position.
+ *    If the node it belongs in is full, that node is split in two first.
+ * 
+ * Worst-case Time Complexity: O(n/K + K)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+bool List<T, K, Allocator, Stats>::insert(const T& item, const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   // find the node the item goes in, and its offset within that node
+   Node * node;
+   int offset;
+   if (_first == 0) {
+      _first = createNode();
+      node = _first;
+      offset = 0;
+   } else if (_size == 0) {
+      node = _first;
+      offset = 0;
+   } else if (position == _size) {
+      // append to the node holding the last element
+      node = findNode(position-1, offset);
+      ++offset;
+   } else {
+      node = findNode(position, offset);
+   }
+   
+   // split a full node, moving its upper half into a new node after it
+   if (node->count == K) {
+      Node * newNode = createNode();
+      moveItems(node->items()+K/2, newNode->items(), K-K/2);
+      this->countMoves(K-K/2);
+      newNode->count = K-K/2;
+      node->count = K/2;
+      
+      newNode->next = node->next;
+      node->next = newNode;
+      
+      if (offset > K/2) {
+         node = newNode;
+         offset -= K/2;
+      }
+   }
+   
+   // shift the later elements of the node and construct the new element
+   openGap(node->items(), node->count, offset, 1);
+   this->countShifts(node->count-offset);
+   new (node->items()+offset) T(item);
+   this->countCopies(1);
+   ++node->count;
+   
+   // increment the size of the current list
+   ++_size;
+   
+   return true;
+}
+
+/**
+ * Remove the item at the specified position
+ * 
+ * Preconditions: The list is not empty and 0 <= position < size
+ * Postconditions: element at the specified position has been removed.
+ * 
+ * Worst-Case Time Complexity: O(n/K + K)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+bool List<T, K, Allocator, Stats>::remove(const int& position) {
+   // verify we can delete an element
+   if (_size==0) {
+      return false;
+   }
+   
+   // verify this is a valid item to delete
+   if (position<0 || position>=_size) {
+      return false;
+   }
+   
+   return removeRange(position, position+1);
+}
+
+/**
+ * Insert the items in [first, last) into the list, starting at the specified
+ * position
+ * 
+ * Preconditions: first and last are input iterators delimiting the items to
+ *    be inserted; 0 <= position <= size
+ * Postcondition: The items are inserted, in order, so that *first is now at
+ *    the specified position. Each insert resumes the walk from the node the
+ *    previous one reached, so the list is walked to position only once.
+ * 
+ * Worst-case Time Complexity: O(n/K + kK), k being the number of items
+ *    inserted
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+template <class Iterator>
+bool List<T, K, Allocator, Stats>::insertRange(Iterator first, Iterator last,
+                                               const int& position) {
+   // verify that this is an acceptable position
+   if (position<0 || position>_size) {
+      return false;
+   }
+   
+   for (int i=position; first!=last; ++first, ++i) {
+      insert(*first, i);
+   }
+   
+   return true;
+}
+
+/**
+ * Remove the items at positions from through to-1
+ * 
+ * Preconditions: 0 <= from <= to <= size
+ * Postconditions: The elements in [from, to) have been removed, a node's
+ *    worth at a time. Nodes left less than half full are rebalanced with
+ *    the nodes after them.
+ * 
+ * Worst-Case Time Complexity: O(n/K + (to-from) + K)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+bool List<T, K, Allocator, Stats>::removeRange(const int& from, const int& to) {
+   // verify this is a valid range to delete
+   if (from<0 || from>to || to>_size) {
+      return false;
+   }
+   
+   int remaining = to-from;
+   while (remaining > 0) {
+      int offset;
+      Node * node = findNode(from, offset);
+      
+      // remove as much of the range as this node holds
+      int count = node->count-offset;
+      if (count > remaining) {
+         count = remaining;
+      }
+      
+      closeGap(node->items(), node->count, offset, offset+count);
+      this->countShifts(node->count-offset-count);
+      node->count -= count;
+      _size -= count;
+      remaining -= count;
+      
+      rebalance(node);
+   }
+   
+   return true;
+}
+
+/**
+ * Get an iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator referring to the first element is returned, or
+ *    end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+typename List<T, K, Allocator, Stats>::iterator
+List<T, K, Allocator, Stats>::begin() {
+   return _size == 0 ? end() : iterator(_first, 0);
+}
+
+/**
+ * Get an iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: An iterator that compares equal to an iterator advanced past
+ *    the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+typename List<T, K, Allocator, Stats>::iterator
+List<T, K, Allocator, Stats>::end() {
+   return iterator(0, 0);
+}
+
+/**
+ * Get a const iterator to the first element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator referring to the first element is returned,
+ *    or end() if the list is empty.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+typename List<T, K, Allocator, Stats>::const_iterator
+List<T, K, Allocator, Stats>::begin() const {
+   return _size == 0 ? end() : const_iterator(_first, 0);
+}
+
+/**
+ * Get a const iterator one past the last element of the list
+ * 
+ * Precondition: N/A
+ * Postcondition: A const_iterator that compares equal to a const_iterator
+ *    advanced past the last element is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+typename List<T, K, Allocator, Stats>::const_iterator
+List<T, K, Allocator, Stats>::end() const {
+   return const_iterator(0, 0);
+}
+
+/*****************************************************************************/
+/********************** Operators ********************************************/
+/*****************************************************************************/
+
+/**
+ * Assign a copy of a list object to the current object
+ * 
+ * Preconditions: N/A
+ * Postconditions: A copy of rhs has been assigned to this object. A const
+ *    reference to this list is returned.
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+const List<T, K, Allocator, Stats>&
+List<T, K, Allocator, Stats>::operator=(const List& rhs) {
+   // verify this is not a self-assignment
+   if (this == &rhs) {
+      return *this;
+   }
+   
+   _size = rhs._size;
+   _cursor = 0;
+   
+   // copy rhs's elements into a new list
+   copyList(rhs._first, _first);
+   
+   return *this;
+}
+
+/*****************************************************************************/
+/********************** Input/Output *****************************************/
+/*****************************************************************************/
+
+/**
+ * Add the elements of the list to a sink, in order
+ * 
+ * Precondition: sink has a member bool add(const T&) that returns false when
+ *    it takes no more elements, as ListWriter does
+ * Postcondition: The elements have been added to sink in list order until it
+ *    took no more. Return true if it took all of them and false otherwise.
+ * 
+ * Worst-Case Time Complexity: O(n); O(k) if sink takes only k elements
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+template <class Sink>
+bool List<T, K, Allocator, Stats>::addItemsTo(Sink& sink) const {
+   for (const Node * ptr = _first; ptr != 0; ptr = ptr->next) {
+      for (int i=0; i<ptr->count; ++i) {
+         if (!sink.add(ptr->items()[i])) {
+            return false;
+         }
+      }
+   }
+   
+   return true;
+}
+
+/**
+ * Output the list
+ * 
+ * Precondition: The ostream, out, is open; limit >= 0, or DISPLAY_ALL
+ * Postcondition: The list represented by this List object has been inserted
+ *    into out through a ListWriter (see listWriter.h). Given a limit, only
+ *    the first limit elements are shown, followed by "..." if there are
+ *    more.
+ * 
+ * Worst-Case Time Complexity: O(n); O(limit) given a limit
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+void List<T, K, Allocator, Stats>::display(std::ostream& out,
+                                           const int& limit) const {
+   ListWriter writer(out, limit, DISPLAY_TERMINATED);
+   addItemsTo(writer);
+   writer.finish();
+}
+
+/**
+ * Output operator for a list object
+ * 
+ * Precondition: The ostream, out, is open
+ * Postcondition: The list represented by the list object has been inserted into
+ *    out
+ * 
+ * Worst-Case Time Comlexity: O(n)
+ */
+template <typename T, int K, template <class> class Allocator, class Stats>
+std::ostream& operator<<(std::ostream& out,
+                         const List<T, K, Allocator, Stats>& list) {
+   list.display(out);
+   
+   return out;
+}
+
+/*****************************************************************************/
+/********************** Private Functions ************************************/
+/*****************************************************************************/
+
+/**
+ * Find the node holding the specified position
+ * 
+ * Precondition: 0 <= position < size
+ * Postcondition: A pointer to the node holding the element at position is
+ *    returned, and offset is set to the element's index within that node.
+ *    The node is remembered so that a later walk to the same or a later
+ *    position can start from it.
+ * 
+ * Worst-Case Time Complexity: O(n/K); O(1) amortized when positions are
+ *    visited in increasing order
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+typename List<T, K, Allocator, Stats>::Node *
+List<T, K, Allocator, Stats>::findNode(const int& position, int& offset) const {
+   Node * ptr = _first;
+   int start = 0;
+   
+   // resume from the remembered node if it is not past the target
+   if (_cursor != 0 && _cursorPosition <= position) {
+      ptr = _cursor;
+      start = _cursorPosition;
+   }
+   
+   int links = 0;
+   while (position >= start+ptr->count) {
+      start += ptr->count;
+      ptr = ptr->next;
+      ++links;
+   }
+   this->countLinks(links);
+   
+   _cursor = ptr;
+   _cursorPosition = start;
+   
+   offset = position-start;
+   
+   return ptr;
+}
+
+/**
+ * Restore the occupancy of a node after elements were removed from it
+ * 
+ * Precondition: node is in this list
+ * Postcondition: If node is less than half full and not the last node, it
+ *    has been merged with the node after it when their elements fit in one
+ *    node, or else has taken enough elements from that node to be half full.
+ *    Nodes before and including node keep their positions, so the cursor
+ *    remains valid. Only the last node may be left empty.
+ * 
+ * Worst-Case Time Complexity: O(K)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+void List<T, K, Allocator, Stats>::rebalance(Node * node) {
+   Node * nextNode = node->next;
+   if (node->count >= K/2 || nextNode == 0) {
+      return;
+   }
+   
+   if (node->count+nextNode->count <= K) {
+      // merge the next node into this one
+      moveItems(nextNode->items(), node->items()+node->count, nextNode->count);
+      this->countMoves(nextNode->count);
+      node->count += nextNode->count;
+      nextNode->count = 0;
+      
+      node->next = nextNode->next;
+      destroyNode(nextNode);
+   } else {
+      // take elements from the front of the next node, which keeps at least
+      // half of its own
+      int count = K/2-node->count;
+      T * items = node->items()+node->count;
+      for (int i=0; i<count; ++i) {
+         new (items+i) T(std::move(nextNode->items()[i]));
+      }
+      this->countMoves(count);
+      closeGap(nextNode->items(), nextNode->count, 0, count);
+      this->countShifts(nextNode->count-count);
+      
+      node->count += count;
+      nextNode->count -= count;
+   }
+}
+
+/**
+ * Copy a linked list
+ * 
+ * Precondition: originalList is the list to be copied
+ * Postcondition: copiedList points to a copy of originalList, node for node
+ * 
+ * Worst-Case Time Complexity: O(n)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+bool List<T, K, Allocator, Stats>::copyList(Node * originalListFirst,
+                                            Node * &copiedListFirst) {
+   // if there is already a list held where the copied list should go, then
+   // delete that list
+   deleteList(copiedListFirst);
+   copiedListFirst = 0;
+   
+   // copy each node, keeping the copy's nodes exactly as full
+   Node * copiedPtr = 0;
+   for (Node * originalPtr = originalListFirst; originalPtr != 0;
+        originalPtr = originalPtr->next) {
+      if (originalPtr->count == 0) {
+         continue;
+      }
+      
+      Node * newNode = createNode();
+      copyItems(originalPtr->items(), newNode->items(), originalPtr->count);
+      this->countCopies(originalPtr->count);
+      newNode->count = originalPtr->count;
+      
+      if (copiedPtr == 0) {
+         copiedListFirst = newNode;
+      } else {
+         copiedPtr->next = newNode;
+      }
+      copiedPtr = newNode;
+   }
+   
+   return true;
+}
+
+/**
+ * Delete a linked list
+ * 
+ * Precondition: The life of the linked list is over. firstPtr is the first
+ *    node of this list, so every node the pool has handed out is in it.
+ * Postcondition: The memory dynamically allocated by each node of the linked
+ *    list is returned to the heap.
+ * 
+ * Worst-Case Time Complexity: O(number of chunks) when T has a trivial
+ *    destructor and the allocator releases in bulk; O(n) otherwise
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+bool List<T, K, Allocator, Stats>::deleteList(Node * firstPtr) {
+   if (Allocator<Node>::BULK_RELEASE) {
+      // the nodes only need to be visited if they have destructors to run
+      if (!std::is_trivially_destructible<T>::value) {
+         for (Node * ptr = firstPtr; ptr != 0; ptr = ptr->next) {
+            ptr->~Node();
+         }
+      }
+      
+      _pool.releaseAll();
+      
+      return true;
+   }
+   
+   Node * ptr = firstPtr;
+   
+   while (ptr != 0) {
+      Node * tempPtr = ptr;
+      ptr = ptr->next;
+      destroyNode(tempPtr);
+   }
+   
+   return true;
+}
+
+/**
+ * Create a node
+ * 
+ * Precondition: N/A
+ * Postcondition: An empty node, allocated from _pool, is returned.
+ * 
+ * Worst-Case Time Complexity: O(1)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+typename List<T, K, Allocator, Stats>::Node *
+List<T, K, Allocator, Stats>::createNode() {
+   this->countAllocation(sizeof(Node));
+   
+   return new (_pool.allocate()) Node;
+}
+
+/**
+ * Destroy a node
+ * 
+ * Precondition: node was created by createNode and is no longer linked into
+ *    the list
+ * Postcondition: The node and its elements have been destroyed and its
+ *    memory returned to _pool.
+ * 
+ * Worst-Case Time Complexity: O(K)
+ */
+template <class T, int K, template <class> class Allocator, class Stats>
+void List<T, K, Allocator, Stats>::destroyNode(Node * node) {
+   node->~Node();
+   _pool.deallocate(node);
+}
+
+#endif /*UNROLLED_LINKED_LIST_H_*/